@@ -0,0 +1,510 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Simd/SimdAmxCpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxCpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxCpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect1x1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect1x1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect1x1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetConvolution8iDirectAny.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirectAny.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirectAny.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Input.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Input.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Input.cpp.o.d"
+  "/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Output.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Output.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Output.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Cpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Cpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Cpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Fill.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Fill.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Fill.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Float32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Float32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Float32.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Gemm32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Gemm32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Gemm32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1HogLite.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1HogLite.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1HogLite.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Neural.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Neural.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Neural.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1NeuralConvolution.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1NeuralConvolution.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1NeuralConvolution.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Resizer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Resizer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Resizer.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1ResizerBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1ResizerBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1ResizerBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SquaredDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SquaredDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SquaredDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Svm.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Svm.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Svm.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Synet.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Synet.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Synet.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetActivation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetActivation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetActivation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConversion.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConversion.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConversion.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNchw.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNchw.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNchw.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNhwc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNhwc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNhwc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect3r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect3r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetDeconvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetFused.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetFused.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetFused.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetInnerProduct32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetInnerProduct32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetInnerProduct32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCd.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCd.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCd.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCdc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCdc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCdc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fDc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fDc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fDc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetPooling.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetPooling.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetPooling.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1SynetScale.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetScale.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetScale.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Winograd1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Winograd2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx1Winograd3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2AbsDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2AbsDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2AbsGradientSaturatedSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsGradientSaturatedSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsGradientSaturatedSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2AddFeatureDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AddFeatureDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AddFeatureDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2AlphaBlending.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AlphaBlending.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AlphaBlending.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Background.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Background.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Background.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Base64.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Base64.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Base64.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BayerToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BayerToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgrToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgrToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgrToRgb.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToRgb.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToRgb.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgrToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgraToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgraToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2BgraToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Binarization.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Binarization.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Binarization.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Conditional.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Conditional.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Conditional.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Cpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Cpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Cpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Deinterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Deinterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Deinterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Detection.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Detection.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Detection.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2EdgeBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2EdgeBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2EdgeBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Fill.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Fill.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Fill.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Float16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Float32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float32.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2GaussianBlur.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GaussianBlur.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GaussianBlur.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Gemm32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Gemm32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Gemm32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2GrayToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2GrayToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Histogram.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Histogram.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Histogram.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Hog.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Hog.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Hog.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2HogLite.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2HogLite.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2HogLite.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ImageLoad.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageLoad.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageLoad.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ImageSave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ImageSaveJpeg.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSaveJpeg.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSaveJpeg.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ImageSavePng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSavePng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSavePng.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Int16ToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Int16ToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Int16ToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Integral.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Integral.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Integral.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Interference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Interleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Laplace.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Laplace.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Laplace.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Lbp.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Lbp.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Lbp.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2MeanFilter3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MeanFilter3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MeanFilter3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2MedianFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MedianFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MedianFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Neural.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Neural.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Neural.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2NeuralConvolution.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2NeuralConvolution.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2NeuralConvolution.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Operation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Operation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Operation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Reduce.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reduce.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reduce.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ReduceGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ReduceGray3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ReduceGray4x4.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray4x4.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray4x4.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ReduceGray5x5.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray5x5.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray5x5.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Reorder.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reorder.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reorder.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ResizeBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizeBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizeBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Resizer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Resizer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Resizer.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ResizerArea.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerArea.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerArea.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ResizerBicubic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBicubic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBicubic.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ResizerBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ResizerNearest.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerNearest.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerNearest.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Segmentation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Segmentation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Segmentation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2ShiftBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ShiftBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ShiftBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Sobel.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Sobel.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Sobel.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SquaredDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SquaredDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SquaredDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Statistic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Statistic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Statistic.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2StatisticMoments.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StatisticMoments.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StatisticMoments.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2StretchGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StretchGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StretchGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Synet.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Synet.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Synet.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetActivation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetActivation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetActivation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConversion.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConversion.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConversion.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNchw.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNchw.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNchw.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNhwc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNhwc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNhwc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect3r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect3r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect1x1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect1x1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect1x1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirectAny.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirectAny.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirectAny.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetDeconvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetInnerProduct32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetInnerProduct32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetInnerProduct32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Depthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Depthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Input.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Input.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Input.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Output.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Output.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Output.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCd.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCd.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCd.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCdc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCdc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCdc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fDc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fDc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fDc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iInput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iInput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iInput.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iOutput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iOutput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iOutput.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetPooling.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetPooling.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetPooling.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2SynetScale.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetScale.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetScale.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Texture.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Texture.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Texture.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2Transform.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Transform.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Transform.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2UyvyToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2UyvyToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2YuvToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2YuvToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2YuvToHue.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToHue.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToHue.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx2YuvToUyvy.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToUyvy.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToUyvy.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwAbsDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwAbsDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwAbsGradientSaturatedSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsGradientSaturatedSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsGradientSaturatedSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwAddFeatureDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAddFeatureDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAddFeatureDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwAlphaBlending.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAlphaBlending.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAlphaBlending.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBase64.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBase64.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBase64.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBayerToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBayerToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgrToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgrToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgrToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgrToRgb.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToRgb.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToRgb.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgrToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgraToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgraToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgraToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBgraToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwBinarization.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBinarization.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBinarization.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwConditional.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwConditional.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwConditional.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwCpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwCpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwCpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwDeinterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDeinterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDeinterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwDetection.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDetection.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDetection.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwEdgeBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwEdgeBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwEdgeBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwFill.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFill.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFill.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwFloat32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat32.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGaussianBlur.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGaussianBlur.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGaussianBlur.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGemm32fNN.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNN.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNN.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGemm32fNT.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNT.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNT.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGemm32fPack.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fPack.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fPack.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGrayToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwGrayToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwHistogram.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHistogram.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHistogram.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwHog.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHog.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHog.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwHogLite.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHogLite.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHogLite.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwImageLoad.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageLoad.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageLoad.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwImageSave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwImageSaveJpeg.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSaveJpeg.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSaveJpeg.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwImageSavePng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSavePng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSavePng.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwInt16ToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInt16ToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInt16ToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwIntegral.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwIntegral.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwIntegral.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwInterference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterference.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwInterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwLaplace.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLaplace.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLaplace.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwLbp.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLbp.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLbp.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwMeanFilter3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMeanFilter3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMeanFilter3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwMedianFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMedianFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMedianFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwNeural.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeural.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeural.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwNeuralConvolution.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeuralConvolution.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeuralConvolution.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwOperation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwOperation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwOperation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReduce.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduce.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduce.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReduceGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReduceGray3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReduceGray4x4.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray4x4.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray4x4.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReduceGray5x5.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray5x5.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray5x5.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwReorder.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReorder.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReorder.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizeBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizeBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizeBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizer.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizerArea.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerArea.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerArea.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizerBicubic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBicubic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBicubic.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizerBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwResizerNearest.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerNearest.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerNearest.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSegmentation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSegmentation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSegmentation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwShiftBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwShiftBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwShiftBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSobel.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSobel.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSobel.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSquaredDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSquaredDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSquaredDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwStatistic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatistic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatistic.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwStatisticMoments.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatisticMoments.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatisticMoments.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwStretchGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStretchGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStretchGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSvm.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSvm.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSvm.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynet.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynet.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynet.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetActivation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetActivation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetActivation.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConversion.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConversion.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConversion.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNchw.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNchw.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNchw.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNhwc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNhwc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNhwc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect3r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect3r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect1x1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect1x1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect1x1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirectAny.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirectAny.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirectAny.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetDeconvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetFused.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetFused.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetFused.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetInnerProduct32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetInnerProduct32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetInnerProduct32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Depthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Depthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Input.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Input.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Input.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Output.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Output.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Output.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCd.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCd.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCd.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCdc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCdc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCdc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fDc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fDc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fDc.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iInput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iInput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iInput.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iOutput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iOutput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iOutput.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetPooling.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetPooling.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetPooling.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwSynetScale.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetScale.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetScale.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwTexture.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTexture.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTexture.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwTile.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTile.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTile.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwTransform.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTransform.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTransform.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwUyvyToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwUyvyToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwWinograd1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwWinograd2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwWinograd3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd3.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuv420pToBgraV2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv420pToBgraV2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv420pToBgraV2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuv444pToBgraV2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv444pToBgraV2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv444pToBgraV2.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuvToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuvToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuvToHue.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToHue.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToHue.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512bwYuvToUyvy.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToUyvy.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToUyvy.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniCpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniCpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniCpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect1x1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect1x1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect1x1.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirectAny.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirectAny.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirectAny.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iInput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iInput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iInput.cpp.o.d"
+  "/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iOutput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iOutput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iOutput.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseAbsDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseAbsDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseAbsGradientSaturatedSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsGradientSaturatedSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsGradientSaturatedSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseAddFeatureDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAddFeatureDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAddFeatureDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseAlphaBlending.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAlphaBlending.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAlphaBlending.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBase64.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBase64.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBase64.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBayerToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBayerToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToHsl.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsl.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsl.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToHsv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsv.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToRgb.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToRgb.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToRgb.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgrToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgraToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgraToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgraToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBgraToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseBinarization.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBinarization.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBinarization.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseConditional.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseConditional.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseConditional.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseCopy.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCopy.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCopy.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseCpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseCrc32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCrc32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCrc32.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseDeinterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDeinterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDeinterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseDetection.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDetection.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDetection.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseEdgeBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseEdgeBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseEdgeBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseFill.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFill.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFill.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseFloat32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat32.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseGaussianBlur.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGaussianBlur.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGaussianBlur.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseGemm32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGemm32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGemm32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseGrayToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseGrayToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseHistogram.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHistogram.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHistogram.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseHog.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHog.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHog.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseHogLite.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHogLite.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHogLite.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageLoad.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoad.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoad.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageLoadJpeg.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadJpeg.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadJpeg.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageLoadPng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadPng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadPng.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageSave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSave.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageSaveJpeg.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSaveJpeg.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSaveJpeg.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseImageSavePng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSavePng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSavePng.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseInt16ToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInt16ToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInt16ToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseIntegral.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseIntegral.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseIntegral.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseInterference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterference.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseInterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseLaplace.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLaplace.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLaplace.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseLbp.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLbp.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLbp.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseMeanFilter3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMeanFilter3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMeanFilter3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseMedianFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMedianFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMedianFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseNeural.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseNeural.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseNeural.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseOperation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseOperation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseOperation.cpp.o.d"
+  "/root/repo/src/Simd/SimdBasePerformance.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBasePerformance.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBasePerformance.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseRecursiveBilateralFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseRecursiveBilateralFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseRecursiveBilateralFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReduce.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduce.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduce.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReduceGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReduceGray3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReduceGray4x4.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray4x4.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray4x4.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReduceGray5x5.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray5x5.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray5x5.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseReorder.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReorder.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReorder.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizeBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizeBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizeBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizer.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizerArea.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerArea.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerArea.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizerBicubic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBicubic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBicubic.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizerBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseResizerNearest.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerNearest.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerNearest.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSegmentation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSegmentation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSegmentation.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseShiftBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseShiftBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseShiftBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSobel.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSobel.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSobel.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSquaredDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSquaredDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSquaredDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseStatistic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatistic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatistic.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseStatisticMoments.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatisticMoments.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatisticMoments.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseStretchGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStretchGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStretchGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSvm.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSvm.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSvm.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynet.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynet.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynet.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetActivation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetActivation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetActivation.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetConversion.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConversion.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConversion.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetDeconvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetFused.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetFused.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetFused.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetInnerProduct32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetInnerProduct8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetMergedConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetMergedConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetMergedConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetPooling.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetPooling.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetPooling.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseSynetScale.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetScale.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetScale.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseTexture.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTexture.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTexture.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseThread.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseThread.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseThread.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseTransform.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTransform.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTransform.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseUyvyToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseUyvyToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseWinograd1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd1.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseWinograd2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd2.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseWinograd3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd3.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToHsl.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsl.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsl.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToHsv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsv.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToHue.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHue.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHue.cpp.o.d"
+  "/root/repo/src/Simd/SimdBaseYuvToUyvy.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToUyvy.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToUyvy.cpp.o.d"
+  "/root/repo/src/Simd/SimdLib.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdLib.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdLib.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41AbsDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41AbsDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41AbsGradientSaturatedSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsGradientSaturatedSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsGradientSaturatedSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41AddFeatureDifference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AddFeatureDifference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AddFeatureDifference.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41AlphaBlending.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AlphaBlending.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AlphaBlending.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BFloat16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BFloat16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BFloat16.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Background.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Background.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Background.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Base64.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Base64.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Base64.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BayerToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BayerToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgrToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgrToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgrToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgrToRgb.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToRgb.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToRgb.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgrToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgraToBayer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBayer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBayer.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgraToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgraToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41BgraToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Binarization.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Binarization.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Binarization.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Conditional.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Conditional.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Conditional.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Cpu.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Cpu.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Cpu.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Crc32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Crc32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Crc32.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Deinterleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Deinterleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Deinterleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Detection.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Detection.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Detection.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41EdgeBackground.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41EdgeBackground.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41EdgeBackground.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Fill.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Fill.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Fill.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Float16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float16.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Float32.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float32.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float32.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41GaussianBlur.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41GaussianBlur3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Gemm32fNN.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNN.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNN.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Gemm32fNT.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNT.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNT.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Gemm32fPack.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fPack.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fPack.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41GrayToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41GrayToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Histogram.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Histogram.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Histogram.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Hog.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Hog.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Hog.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41HogLite.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41HogLite.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41HogLite.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ImageLoad.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoad.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoad.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ImageLoadPng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoadPng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoadPng.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ImageSave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSave.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ImageSaveJpeg.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSaveJpeg.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSaveJpeg.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ImageSavePng.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSavePng.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSavePng.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Int16ToGray.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Int16ToGray.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Int16ToGray.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Interference.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interference.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interference.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Interleave.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interleave.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interleave.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Laplace.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Laplace.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Laplace.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Lbp.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Lbp.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Lbp.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41MeanFilter3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MeanFilter3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MeanFilter3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41MedianFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MedianFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MedianFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Neural.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Neural.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Neural.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41NeuralConvolution.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41NeuralConvolution.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41NeuralConvolution.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Operation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Operation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Operation.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41RecursiveBilateralFilter.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41RecursiveBilateralFilter.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41RecursiveBilateralFilter.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Reduce.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reduce.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reduce.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ReduceGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ReduceGray3x3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray3x3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray3x3.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ReduceGray4x4.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray4x4.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray4x4.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ReduceGray5x5.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray5x5.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray5x5.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Reorder.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reorder.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reorder.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ResizeBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizeBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizeBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Resizer.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Resizer.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Resizer.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ResizerArea.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerArea.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerArea.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ResizerBicubic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBicubic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBicubic.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ResizerBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ResizerNearest.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerNearest.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerNearest.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Segmentation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Segmentation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Segmentation.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41ShiftBilinear.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ShiftBilinear.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ShiftBilinear.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Sobel.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Sobel.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Sobel.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SquaredDifferenceSum.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SquaredDifferenceSum.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SquaredDifferenceSum.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Statistic.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Statistic.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Statistic.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41StatisticMoments.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StatisticMoments.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StatisticMoments.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41StretchGray2x2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StretchGray2x2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StretchGray2x2.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Svm.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Svm.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Svm.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Synet.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Synet.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Synet.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetActivation.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetActivation.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetActivation.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConversion.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConversion.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConversion.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNchw.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNchw.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNchw.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNhwc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNhwc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNhwc.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect3r.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect3r.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect1x1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect1x1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect1x1.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirectAny.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirectAny.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirectAny.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetDeconvolution32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetFused.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetFused.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetFused.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetInnerProduct32f.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct32f.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct32f.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetInnerProduct8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Depthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Depthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Input.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Input.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Input.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Output.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Output.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Output.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCd.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCd.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCd.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCdc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCdc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCdc.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fDc.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fDc.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fDc.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution8i.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iDepthwise.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iDepthwise.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iDepthwise.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iInput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iInput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iInput.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iOutput.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iOutput.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iOutput.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetPooling.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetPooling.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetPooling.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41SynetScale.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetScale.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetScale.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Texture.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Texture.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Texture.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Transform.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Transform.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Transform.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41UyvyToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41UyvyToYuv.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToYuv.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToYuv.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Winograd1.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd1.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd1.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Winograd2.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd2.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd2.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41Winograd3.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd3.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd3.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41YuvToBgr.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgr.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgr.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41YuvToBgra.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgra.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgra.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41YuvToHue.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToHue.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToHue.cpp.o.d"
+  "/root/repo/src/Simd/SimdSse41YuvToUyvy.cpp" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToUyvy.cpp.o" "gcc" "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToUyvy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,993 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxCpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxCpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect1x1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirect1x1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirectAny.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetConvolution8iDirectAny.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Input.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Input.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Output.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAmxSynetMergedConvolution32fBf16Output.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Cpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Cpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Fill.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Fill.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Float32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Float32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Gemm32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Gemm32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1HogLite.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1HogLite.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Neural.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Neural.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1NeuralConvolution.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1NeuralConvolution.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Resizer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Resizer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1ResizerBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1ResizerBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SquaredDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SquaredDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Svm.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Svm.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Synet.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Synet.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetActivation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetActivation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConversion.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConversion.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNchw.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNchw.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNhwc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fDirectNhwc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect3r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetFused.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetFused.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetInnerProduct32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetInnerProduct32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCd.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCd.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCdc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fCdc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fDc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetMergedConvolution32fDc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetPooling.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetPooling.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetScale.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1SynetScale.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx1Winograd3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsGradientSaturatedSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AbsGradientSaturatedSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AddFeatureDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AddFeatureDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AlphaBlending.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2AlphaBlending.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Background.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Background.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Base64.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Base64.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BayerToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToRgb.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToRgb.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgrToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2BgraToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Binarization.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Binarization.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Conditional.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Conditional.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Cpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Cpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Deinterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Deinterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Detection.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Detection.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2EdgeBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2EdgeBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Fill.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Fill.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Float32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GaussianBlur.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GaussianBlur.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Gemm32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Gemm32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2GrayToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Histogram.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Histogram.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Hog.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Hog.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2HogLite.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2HogLite.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageLoad.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageLoad.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSaveJpeg.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSaveJpeg.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSavePng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ImageSavePng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Int16ToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Int16ToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Integral.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Integral.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Interleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Laplace.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Laplace.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Lbp.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Lbp.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MeanFilter3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MeanFilter3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MedianFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2MedianFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Neural.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Neural.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2NeuralConvolution.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2NeuralConvolution.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Operation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Operation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reduce.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reduce.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray4x4.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray4x4.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray5x5.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ReduceGray5x5.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reorder.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Reorder.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizeBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizeBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Resizer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Resizer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerArea.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerArea.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBicubic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBicubic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerNearest.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ResizerNearest.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Segmentation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Segmentation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ShiftBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2ShiftBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Sobel.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Sobel.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SquaredDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SquaredDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Statistic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Statistic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StatisticMoments.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StatisticMoments.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StretchGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2StretchGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Synet.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Synet.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetActivation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetActivation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConversion.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConversion.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNchw.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNchw.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNhwc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fDirectNhwc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect3r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect1x1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirect1x1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirectAny.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetConvolution8iDirectAny.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetInnerProduct32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetInnerProduct32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Depthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Input.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Input.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Output.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fBf16Output.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCd.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCd.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCdc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fCdc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fDc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution32fDc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iInput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iInput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iOutput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetMergedConvolution8iOutput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetPooling.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetPooling.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetScale.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2SynetScale.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Texture.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Texture.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Transform.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2Transform.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2UyvyToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToHue.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToHue.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToUyvy.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx2YuvToUyvy.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsGradientSaturatedSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAbsGradientSaturatedSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAddFeatureDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAddFeatureDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAlphaBlending.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwAlphaBlending.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBase64.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBase64.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBayerToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToRgb.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToRgb.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgrToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBgraToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBinarization.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwBinarization.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwConditional.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwConditional.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwCpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwCpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDeinterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDeinterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDetection.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwDetection.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwEdgeBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwEdgeBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFill.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFill.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwFloat32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGaussianBlur.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGaussianBlur.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNN.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNN.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNT.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fNT.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fPack.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGemm32fPack.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwGrayToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHistogram.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHistogram.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHog.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHog.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHogLite.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwHogLite.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageLoad.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageLoad.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSaveJpeg.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSaveJpeg.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSavePng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwImageSavePng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInt16ToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInt16ToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwIntegral.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwIntegral.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwInterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLaplace.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLaplace.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLbp.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwLbp.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMeanFilter3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMeanFilter3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMedianFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwMedianFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeural.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeural.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeuralConvolution.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwNeuralConvolution.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwOperation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwOperation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduce.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduce.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray4x4.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray4x4.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray5x5.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReduceGray5x5.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReorder.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwReorder.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizeBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizeBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerArea.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerArea.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBicubic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBicubic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerNearest.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwResizerNearest.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSegmentation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSegmentation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwShiftBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwShiftBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSobel.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSobel.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSquaredDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSquaredDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatistic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatistic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatisticMoments.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStatisticMoments.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStretchGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwStretchGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSvm.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSvm.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynet.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynet.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetActivation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetActivation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConversion.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConversion.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNchw.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNchw.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNhwc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fDirectNhwc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect3r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect1x1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirect1x1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirectAny.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetConvolution8iDirectAny.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetFused.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetFused.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetInnerProduct32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetInnerProduct32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Depthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Input.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Input.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Output.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fBf16Output.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCd.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCd.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCdc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fCdc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fDc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution32fDc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iInput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iInput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iOutput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetMergedConvolution8iOutput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetPooling.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetPooling.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetScale.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwSynetScale.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTexture.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTexture.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTile.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTile.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTransform.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwTransform.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwUyvyToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwWinograd3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv420pToBgraV2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv420pToBgraV2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv444pToBgraV2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuv444pToBgraV2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToHue.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToHue.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToUyvy.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512bwYuvToUyvy.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniCpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniCpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect1x1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirect1x1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirectAny.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetConvolution8iDirectAny.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iInput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iInput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iOutput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdAvx512vnniSynetMergedConvolution8iOutput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsGradientSaturatedSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAbsGradientSaturatedSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAddFeatureDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAddFeatureDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAlphaBlending.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseAlphaBlending.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBase64.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBase64.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBayerToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsl.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsl.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToHsv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToRgb.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToRgb.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgrToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBgraToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBinarization.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseBinarization.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseConditional.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseConditional.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCopy.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCopy.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCrc32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseCrc32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDeinterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDeinterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDetection.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseDetection.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseEdgeBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseEdgeBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFill.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFill.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseFloat32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGaussianBlur.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGaussianBlur.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGemm32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGemm32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseGrayToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHistogram.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHistogram.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHog.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHog.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHogLite.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseHogLite.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoad.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoad.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadJpeg.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadJpeg.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadPng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageLoadPng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSaveJpeg.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSaveJpeg.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSavePng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseImageSavePng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInt16ToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInt16ToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseIntegral.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseIntegral.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseInterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLaplace.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLaplace.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLbp.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseLbp.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMeanFilter3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMeanFilter3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMedianFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseMedianFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseNeural.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseNeural.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseOperation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseOperation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBasePerformance.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBasePerformance.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseRecursiveBilateralFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseRecursiveBilateralFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduce.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduce.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray4x4.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray4x4.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray5x5.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReduceGray5x5.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReorder.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseReorder.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizeBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizeBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerArea.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerArea.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBicubic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBicubic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerNearest.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseResizerNearest.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSegmentation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSegmentation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseShiftBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseShiftBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSobel.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSobel.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSquaredDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSquaredDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatistic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatistic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatisticMoments.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStatisticMoments.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStretchGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseStretchGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSvm.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSvm.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynet.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynet.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetActivation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetActivation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConversion.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConversion.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetFused.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetFused.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetInnerProduct8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetPooling.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetPooling.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetScale.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseSynetScale.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTexture.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTexture.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseThread.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseThread.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTransform.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseTransform.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseUyvyToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseWinograd3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsl.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsl.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHsv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHue.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToHue.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToUyvy.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdBaseYuvToUyvy.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdLib.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdLib.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsGradientSaturatedSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AbsGradientSaturatedSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AddFeatureDifference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AddFeatureDifference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AlphaBlending.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41AlphaBlending.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BFloat16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BFloat16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Background.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Background.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Base64.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Base64.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BayerToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToRgb.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToRgb.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgrToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBayer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBayer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41BgraToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Binarization.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Binarization.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Conditional.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Conditional.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Cpu.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Cpu.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Crc32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Crc32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Deinterleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Deinterleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Detection.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Detection.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41EdgeBackground.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41EdgeBackground.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Fill.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Fill.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float32.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Float32.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GaussianBlur3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNN.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNN.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNT.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fNT.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fPack.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Gemm32fPack.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41GrayToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Histogram.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Histogram.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Hog.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Hog.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41HogLite.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41HogLite.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoad.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoad.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoadPng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageLoadPng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSaveJpeg.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSaveJpeg.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSavePng.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ImageSavePng.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Int16ToGray.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Int16ToGray.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interference.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interference.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interleave.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Interleave.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Laplace.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Laplace.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Lbp.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Lbp.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MeanFilter3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MeanFilter3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MedianFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41MedianFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Neural.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Neural.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41NeuralConvolution.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41NeuralConvolution.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Operation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Operation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41RecursiveBilateralFilter.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41RecursiveBilateralFilter.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reduce.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reduce.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray3x3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray3x3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray4x4.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray4x4.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray5x5.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ReduceGray5x5.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reorder.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Reorder.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizeBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizeBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Resizer.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Resizer.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerArea.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerArea.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBicubic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBicubic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerNearest.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ResizerNearest.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Segmentation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Segmentation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ShiftBilinear.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41ShiftBilinear.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Sobel.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Sobel.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SquaredDifferenceSum.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SquaredDifferenceSum.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Statistic.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Statistic.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StatisticMoments.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StatisticMoments.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StretchGray2x2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41StretchGray2x2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Svm.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Svm.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Synet.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Synet.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetActivation.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetActivation.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConversion.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConversion.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNchw.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNchw.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNhwc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fDirectNhwc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect2r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect3r.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution32fNhwcDirect3r.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect1x1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirect1x1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirectAny.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetConvolution8iNhwcDirectAny.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetFused.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetFused.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct32f.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct32f.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetInnerProduct8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Depthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Depthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Input.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Input.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Output.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fBf16Output.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCd.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCd.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCdc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fCdc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fDc.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution32fDc.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iDepthwise.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iDepthwise.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iInput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iInput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iOutput.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetMergedConvolution8iOutput.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetPooling.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetPooling.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetScale.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41SynetScale.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Texture.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Texture.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Transform.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Transform.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToYuv.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41UyvyToYuv.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd1.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd1.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd2.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd2.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd3.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41Winograd3.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgr.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgr.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgra.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToBgra.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToHue.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToHue.cpp.o.d"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToUyvy.cpp.o"
+  "CMakeFiles/Simd.dir/root/repo/src/Simd/SimdSse41YuvToUyvy.cpp.o.d"
+  "libSimd.a"
+  "libSimd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Simd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,99 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Test/TestCheckC.c" "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckC.c.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckC.c.o.d"
+  "/root/repo/src/Test/Test.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/Test.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/Test.cpp.o.d"
+  "/root/repo/src/Test/TestAbsDifference.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAbsDifference.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAbsDifference.cpp.o.d"
+  "/root/repo/src/Test/TestAddFeatureDifference.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAddFeatureDifference.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAddFeatureDifference.cpp.o.d"
+  "/root/repo/src/Test/TestAnyToAny.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToAny.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToAny.cpp.o.d"
+  "/root/repo/src/Test/TestAnyToBayer.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBayer.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBayer.cpp.o.d"
+  "/root/repo/src/Test/TestAnyToBgra.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBgra.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBgra.cpp.o.d"
+  "/root/repo/src/Test/TestAnyToYuv.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToYuv.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToYuv.cpp.o.d"
+  "/root/repo/src/Test/TestBFloat16.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBFloat16.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBFloat16.cpp.o.d"
+  "/root/repo/src/Test/TestBackground.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBackground.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBackground.cpp.o.d"
+  "/root/repo/src/Test/TestBase64.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBase64.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBase64.cpp.o.d"
+  "/root/repo/src/Test/TestBayerToBgr.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgr.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgr.cpp.o.d"
+  "/root/repo/src/Test/TestBayerToBgra.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgra.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgra.cpp.o.d"
+  "/root/repo/src/Test/TestBgr48pToBgra32.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBgr48pToBgra32.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBgr48pToBgra32.cpp.o.d"
+  "/root/repo/src/Test/TestBinarization.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestBinarization.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestBinarization.cpp.o.d"
+  "/root/repo/src/Test/TestCheckCpp.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckCpp.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckCpp.cpp.o.d"
+  "/root/repo/src/Test/TestCompare.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestCompare.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestCompare.cpp.o.d"
+  "/root/repo/src/Test/TestConditional.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestConditional.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestConditional.cpp.o.d"
+  "/root/repo/src/Test/TestContour.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestContour.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestContour.cpp.o.d"
+  "/root/repo/src/Test/TestCopy.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestCopy.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestCopy.cpp.o.d"
+  "/root/repo/src/Test/TestCrc32.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestCrc32.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestCrc32.cpp.o.d"
+  "/root/repo/src/Test/TestData.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestData.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestData.cpp.o.d"
+  "/root/repo/src/Test/TestDeinterleave.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestDeinterleave.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestDeinterleave.cpp.o.d"
+  "/root/repo/src/Test/TestDetection.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestDetection.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestDetection.cpp.o.d"
+  "/root/repo/src/Test/TestDifferenceSum.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestDifferenceSum.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestDifferenceSum.cpp.o.d"
+  "/root/repo/src/Test/TestDrawing.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestDrawing.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestDrawing.cpp.o.d"
+  "/root/repo/src/Test/TestEdgeBackground.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestEdgeBackground.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestEdgeBackground.cpp.o.d"
+  "/root/repo/src/Test/TestFile.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFile.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFile.cpp.o.d"
+  "/root/repo/src/Test/TestFill.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFill.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFill.cpp.o.d"
+  "/root/repo/src/Test/TestFilter.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFilter.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFilter.cpp.o.d"
+  "/root/repo/src/Test/TestFloat16.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat16.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat16.cpp.o.d"
+  "/root/repo/src/Test/TestFloat32.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat32.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat32.cpp.o.d"
+  "/root/repo/src/Test/TestFont.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestFont.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestFont.cpp.o.d"
+  "/root/repo/src/Test/TestGemm.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestGemm.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestGemm.cpp.o.d"
+  "/root/repo/src/Test/TestHistogram.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestHistogram.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestHistogram.cpp.o.d"
+  "/root/repo/src/Test/TestHog.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestHog.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestHog.cpp.o.d"
+  "/root/repo/src/Test/TestHogLite.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestHogLite.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestHogLite.cpp.o.d"
+  "/root/repo/src/Test/TestHtml.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestHtml.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestHtml.cpp.o.d"
+  "/root/repo/src/Test/TestImageIO.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestImageIO.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestImageIO.cpp.o.d"
+  "/root/repo/src/Test/TestImageMatcher.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestImageMatcher.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestImageMatcher.cpp.o.d"
+  "/root/repo/src/Test/TestIntegral.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestIntegral.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestIntegral.cpp.o.d"
+  "/root/repo/src/Test/TestInterference.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestInterference.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestInterference.cpp.o.d"
+  "/root/repo/src/Test/TestInterleave.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestInterleave.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestInterleave.cpp.o.d"
+  "/root/repo/src/Test/TestLog.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestLog.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestLog.cpp.o.d"
+  "/root/repo/src/Test/TestMotion.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestMotion.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestMotion.cpp.o.d"
+  "/root/repo/src/Test/TestNeural.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestNeural.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestNeural.cpp.o.d"
+  "/root/repo/src/Test/TestNeuralConvolution.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestNeuralConvolution.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestNeuralConvolution.cpp.o.d"
+  "/root/repo/src/Test/TestOperation.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestOperation.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestOperation.cpp.o.d"
+  "/root/repo/src/Test/TestPerformance.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestPerformance.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestPerformance.cpp.o.d"
+  "/root/repo/src/Test/TestRandom.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestRandom.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestRandom.cpp.o.d"
+  "/root/repo/src/Test/TestReduce.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestReduce.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestReduce.cpp.o.d"
+  "/root/repo/src/Test/TestReorder.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestReorder.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestReorder.cpp.o.d"
+  "/root/repo/src/Test/TestResize.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestResize.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestResize.cpp.o.d"
+  "/root/repo/src/Test/TestSegmentation.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSegmentation.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSegmentation.cpp.o.d"
+  "/root/repo/src/Test/TestShift.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestShift.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestShift.cpp.o.d"
+  "/root/repo/src/Test/TestStatistic.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestStatistic.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestStatistic.cpp.o.d"
+  "/root/repo/src/Test/TestStretchGray.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestStretchGray.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestStretchGray.cpp.o.d"
+  "/root/repo/src/Test/TestString.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestString.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestString.cpp.o.d"
+  "/root/repo/src/Test/TestSvm.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSvm.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSvm.cpp.o.d"
+  "/root/repo/src/Test/TestSynet.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynet.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynet.cpp.o.d"
+  "/root/repo/src/Test/TestSynetActivation.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetActivation.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetActivation.cpp.o.d"
+  "/root/repo/src/Test/TestSynetConversion.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConversion.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConversion.cpp.o.d"
+  "/root/repo/src/Test/TestSynetConvolution32f.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution32f.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution32f.cpp.o.d"
+  "/root/repo/src/Test/TestSynetConvolution8i.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution8i.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution8i.cpp.o.d"
+  "/root/repo/src/Test/TestSynetDeconvolution32f.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetDeconvolution32f.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetDeconvolution32f.cpp.o.d"
+  "/root/repo/src/Test/TestSynetFused.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetFused.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetFused.cpp.o.d"
+  "/root/repo/src/Test/TestSynetInnerProduct.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetInnerProduct.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetInnerProduct.cpp.o.d"
+  "/root/repo/src/Test/TestSynetMergedConvolution32f.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution32f.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution32f.cpp.o.d"
+  "/root/repo/src/Test/TestSynetMergedConvolution8i.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution8i.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution8i.cpp.o.d"
+  "/root/repo/src/Test/TestSynetPooling.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetPooling.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetPooling.cpp.o.d"
+  "/root/repo/src/Test/TestSynetScale.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetScale.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetScale.cpp.o.d"
+  "/root/repo/src/Test/TestTable.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestTable.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestTable.cpp.o.d"
+  "/root/repo/src/Test/TestTexture.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestTexture.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestTexture.cpp.o.d"
+  "/root/repo/src/Test/TestTransform.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestTransform.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestTransform.cpp.o.d"
+  "/root/repo/src/Test/TestUtils.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestUtils.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestUtils.cpp.o.d"
+  "/root/repo/src/Test/TestUyvyToBgr.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestUyvyToBgr.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestUyvyToBgr.cpp.o.d"
+  "/root/repo/src/Test/TestVideo.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestVideo.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestVideo.cpp.o.d"
+  "/root/repo/src/Test/TestWinograd.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestWinograd.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestWinograd.cpp.o.d"
+  "/root/repo/src/Test/TestYuvToAny.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToAny.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToAny.cpp.o.d"
+  "/root/repo/src/Test/TestYuvToBgra.cpp" "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToBgra.cpp.o" "gcc" "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToBgra.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_amx_build/CMakeFiles/Simd.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,169 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test.dir/root/repo/src/Test/Test.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/Test.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAbsDifference.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAbsDifference.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAddFeatureDifference.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAddFeatureDifference.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToAny.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToAny.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBayer.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBayer.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBgra.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToBgra.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToYuv.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestAnyToYuv.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBFloat16.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBFloat16.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBackground.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBackground.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBase64.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBase64.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgr.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgr.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgra.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBayerToBgra.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBgr48pToBgra32.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBgr48pToBgra32.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBinarization.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestBinarization.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckC.c.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckC.c.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckCpp.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCheckCpp.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCompare.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCompare.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestConditional.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestConditional.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestContour.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestContour.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCopy.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCopy.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCrc32.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestCrc32.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestData.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestData.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDeinterleave.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDeinterleave.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDetection.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDetection.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDifferenceSum.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDifferenceSum.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDrawing.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestDrawing.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestEdgeBackground.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestEdgeBackground.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFile.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFile.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFill.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFill.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFilter.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFilter.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat16.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat16.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat32.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFloat32.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFont.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestFont.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestGemm.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestGemm.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHistogram.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHistogram.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHog.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHog.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHogLite.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHogLite.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHtml.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestHtml.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestImageIO.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestImageIO.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestImageMatcher.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestImageMatcher.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestIntegral.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestIntegral.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestInterference.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestInterference.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestInterleave.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestInterleave.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestLog.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestLog.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestMotion.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestMotion.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestNeural.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestNeural.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestNeuralConvolution.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestNeuralConvolution.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestOperation.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestOperation.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestPerformance.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestPerformance.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestRandom.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestRandom.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestReduce.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestReduce.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestReorder.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestReorder.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestResize.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestResize.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSegmentation.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSegmentation.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestShift.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestShift.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestStatistic.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestStatistic.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestStretchGray.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestStretchGray.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestString.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestString.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSvm.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSvm.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynet.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynet.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetActivation.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetActivation.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConversion.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConversion.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution32f.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution32f.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution8i.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetConvolution8i.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetDeconvolution32f.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetDeconvolution32f.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetFused.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetFused.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetInnerProduct.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetInnerProduct.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution32f.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution32f.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution8i.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetMergedConvolution8i.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetPooling.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetPooling.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetScale.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestSynetScale.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTable.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTable.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTexture.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTexture.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTransform.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestTransform.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestUtils.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestUtils.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestUyvyToBgr.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestUyvyToBgr.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestVideo.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestVideo.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestWinograd.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestWinograd.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToAny.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToAny.cpp.o.d"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToBgra.cpp.o"
+  "CMakeFiles/Test.dir/root/repo/src/Test/TestYuvToBgra.cpp.o.d"
+  "Test"
+  "Test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/Test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
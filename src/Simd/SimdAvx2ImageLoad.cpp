@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdAvx2.h"
 
 #include <memory>
@@ -124,6 +125,14 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
+            : Sse41::ImagePngLoader(param)
+        {
+            _adler32 = Avx2::ZlibAdler32;
+        }
+
+        //---------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -132,7 +141,7 @@ namespace Simd
             case SimdImageFilePgmBin: return new ImagePgmBinLoader(param);
             case SimdImageFilePpmTxt: return new ImagePpmTxtLoader(param);
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
-            case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
+            case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new Base::ImageJpegLoader(param);
             default:
                 return NULL;
@@ -153,6 +162,45 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Downscale())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            param.left = left;
+            param.top = top;
+            param.right = right;
+            param.bottom = bottom;
+            if (param.Region() && param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Crop())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        void* ImageDecoderInit(SimdPixelFormatType format)
+        {
+            return new ImageDecoder(format, CreateImageLoader);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
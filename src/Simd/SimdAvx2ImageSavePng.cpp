@@ -33,37 +33,37 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
-        static uint32_t ZlibAdler32(uint8_t* data, int size)
+        uint32_t ZlibAdler32(uint8_t* data, int size)
         {
-            __m256i _i0 = _mm256_setr_epi32(0, -1, -2, -3, -4, -5, -6, -7), _8 = _mm256_set1_epi32(8);
+            const int BLOCK = 32, NMAX = 5552 / BLOCK * BLOCK;
+            const __m256i K = SIMD_MM256_SETR_EPI8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
             uint32_t lo = 1, hi = 0;
-            for (int b = 0, n = (int)(size % 5552); b < size;)
+            int i = 0, sizeA = size & (~(BLOCK - 1));
+            while (i < sizeA)
             {
-                int n8 = n & (~7), i = 0;
-                __m256i _i = _mm256_add_epi32(_i0, _mm256_set1_epi32(n));
-                __m256i _l = _mm256_setzero_si256(), _h = _mm256_setzero_si256();
-                for (; i < n8; i += 8)
+                int n = Min(sizeA - i, NMAX);
+                __m256i s1 = _mm256_setzero_si256(), s2 = _mm256_setzero_si256(), ps = _mm256_setzero_si256();
+                for (int end = i + n; i < end; i += BLOCK)
                 {
-                    __m256i d = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(data + b + i)));
-                    _l = _mm256_add_epi32(_l, d);
-                    _h = _mm256_add_epi32(_h, _mm256_mullo_epi32(d, _i));
-                    _i = _mm256_sub_epi32(_i, _8);
+                    __m256i d = _mm256_loadu_si256((__m256i*)(data + i));
+                    ps = _mm256_add_epi32(ps, s1);
+                    s1 = _mm256_add_epi32(s1, _mm256_sad_epu8(d, K_ZERO));
+                    s2 = _mm256_add_epi32(s2, _mm256_madd_epi16(_mm256_maddubs_epi16(d, K), K16_0001));
                 }
-                int l = Avx2::ExtractSum<uint32_t>(_l), h = Avx2::ExtractSum<uint32_t>(_h);
-                for (; i < n; ++i)
-                {
-                    l += data[b + i];
-                    h += data[b + i]*(n - i);
-                }
-                hi = (hi + h + lo*n) % 65521;
-                lo = (lo + l) % 65521;
-                b += n;
-                n = 5552;
+                s2 = _mm256_add_epi32(s2, _mm256_slli_epi32(ps, 5));
+                hi = (hi + lo * n + ExtractSum<uint32_t>(s2)) % 65521;
+                lo = (lo + ExtractSum<uint32_t>(s1)) % 65521;
+            }
+            for (; i < size; ++i)
+            {
+                lo += data[i];
+                hi += lo;
             }
-            return (hi << 16) | lo;
+            return ((hi % 65521) << 16) | (lo % 65521);
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -72,12 +72,23 @@ namespace Simd
             Array32i hashTable(ZHASH * basket);
             memset(hashTable.data, -1, hashTable.RawSize());
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            int i = Max(begin - 32768, 0), j;
+            for (; i < begin; ++i)
+            {
+                int* hList = hashTable.data + (Base::ZlibHash(data + i) & (ZHASH - 1)) * basket;
+                for (j = 0; j < basket && hList[j] != -1; ++j);
+                if (j == basket)
+                {
+                    memcpy(hList, hList + quality, quality * sizeof(int));
+                    memset(hList + quality, -1, quality * sizeof(int));
+                    j = quality;
+                }
+                hList[j] = i;
+            }
+
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
 
-            int i = 0, j;
             while (i < size - 3)
             {
                 int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
@@ -144,7 +155,16 @@ namespace Simd
             for (; i < size; ++i)
                 Base::ZlibHuffB(data[i], stream);
             Base::ZlibHuff(256, stream);
+            if (!last)
+                Base::ZlibSyncFlush(stream);
             stream.FlushBits();
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            ZlibDeflate(data, 0, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -364,6 +384,8 @@ namespace Simd
             _encode[5] = Avx2::EncodeLine5;
             _encode[6] = Avx2::EncodeLine6;
             _compress = Avx2::ZlibCompress;
+            _deflate = Avx2::ZlibDeflate;
+            _adler32 = Avx2::ZlibAdler32;
         }
     }
 #endif// SIMD_AVX2_ENABLE
@@ -415,20 +415,15 @@ namespace Simd
                 else
                     return new Base::SynetConvolution32fBf16Gemm(param);
             }
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx2::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
             else
-                return new SynetConvolution32fGemmNN(param);
+                return Base::SynetConvolution32fSelector(param)
+                    .Add<Avx::SynetConvolution32fDepthwiseDotProduct>()
+                    .Add<SynetConvolution32fWinograd>()
+                    .Add<SynetConvolution32fGemmNT>()
+                    .Add<Avx2::SynetConvolution32fDirectNchw>()
+                    .Add<SynetConvolution32fNhwcDirect>()
+                    .Add<SynetConvolution32fDirectNhwc>()
+                    .Last<SynetConvolution32fGemmNN>();
         }
     }
 #endif//SIMD_AVX2_ENABLE
@@ -239,7 +239,9 @@ namespace Simd
             DeconvParam32f param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
-            if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
+            if (Base::Bf16Soft(compatibility) && Base::SynetDeconvolution32fBf16Gemm::Preferable(param))
+                return new Base::SynetDeconvolution32fBf16Gemm(param, Avx2::SynetConvolution32fInit, Avx2::ConvolutionBiasAndActivation);
+            else if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
                 return new SynetDeconvolution32fGemmNN(param);
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetInnerProduct32f.h"
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdAvx512bw.h"
@@ -918,6 +920,30 @@ namespace Simd
             }
             return Avx512bw::SynetConvolution32fInit(batch, conv, compatibility);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+        {
+            DeconvParam32f param(batch, conv, compatibility);
+            if (!param.Valid())
+                return NULL;
+            else if ((Base::Bf16Soft(compatibility) || Base::Bf16Hard(compatibility)) && Base::SynetDeconvolution32fBf16Gemm::Preferable(param))
+                return new Base::SynetDeconvolution32fBf16Gemm(param, Avx512bf16::SynetConvolution32fInit, Avx512bw::ConvolutionBiasAndActivation);
+            return Avx512bw::SynetDeconvolution32fInit(batch, conv, compatibility);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam32f param(batch, input, output, transpose, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            else if (Base::Bf16Soft(compatibility) || Base::Bf16Hard(compatibility))
+                return new Base::SynetInnerProduct32fBf16(param, Avx512bf16::SynetConvolution32fInit);
+            return Avx512bw::SynetInnerProduct32fInit(batch, input, output, transpose, activation, compatibility);
+        }
     }
 #endif
 }
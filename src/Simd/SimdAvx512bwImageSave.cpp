@@ -101,7 +101,8 @@ namespace Simd
             case SimdImageFilePpmTxt: return new ImagePpmTxtSaver(param);
             case SimdImageFilePpmBin: return new ImagePpmBinSaver(param);
             case SimdImageFilePng: return new ImagePngSaver(param);
-            case SimdImageFileJpeg: return new ImageJpegSaver(param);
+            case SimdImageFileJpeg:
+            case SimdImageFileJpegOptimized: return new ImageJpegSaver(param);
             default:
                 return NULL;
             }
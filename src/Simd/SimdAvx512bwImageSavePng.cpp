@@ -33,40 +33,38 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
-        static uint32_t ZlibAdler32(uint8_t* data, int size)
+        uint32_t ZlibAdler32(uint8_t* data, int size)
         {
-            __m512i _i0 = _mm512_setr_epi32(0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15), _16 = _mm512_set1_epi32(16);
+            const int BLOCK = 64, NMAX = 5552 / BLOCK * BLOCK;
+            const __m512i K = SIMD_MM512_SETR_EPI8(
+                64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
+                32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
             uint32_t lo = 1, hi = 0;
-            for (int b = 0, n = (int)(size % 5552); b < size;)
+            int i = 0, sizeA = size & (~(BLOCK - 1));
+            while (i < sizeA)
             {
-                int n16 = n & (~15), i = 0;
-                __m512i _i = _mm512_add_epi32(_i0, _mm512_set1_epi32(n));
-                __m512i _l = _mm512_setzero_si512(), _h = _mm512_setzero_si512();
-                for (; i < n16; i += 16)
+                int n = Min(sizeA - i, NMAX);
+                __m512i s1 = _mm512_setzero_si512(), s2 = _mm512_setzero_si512(), ps = _mm512_setzero_si512();
+                for (int end = i + n; i < end; i += BLOCK)
                 {
-                    __m512i d = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(data + b + i)));
-                    _l = _mm512_add_epi32(_l, d);
-                    _h = _mm512_add_epi32(_h, _mm512_mullo_epi32(d, _i));
-                    _i = _mm512_sub_epi32(_i, _16);
+                    __m512i d = _mm512_loadu_si512((__m512i*)(data + i));
+                    ps = _mm512_add_epi32(ps, s1);
+                    s1 = _mm512_add_epi32(s1, _mm512_sad_epu8(d, K_ZERO));
+                    s2 = _mm512_add_epi32(s2, _mm512_madd_epi16(_mm512_maddubs_epi16(d, K), K16_0001));
                 }
-                if (i < n)
-                {
-                    __mmask16 t = TailMask16(n - i);
-                    __m512i d = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(t, (__m128i*)(data + b + i)));
-                    _l = _mm512_add_epi32(_l, d);
-                    _h = _mm512_add_epi32(_h, _mm512_mullo_epi32(d, _i));
-                    _i = _mm512_sub_epi32(_i, _16);
-                }
-                int l = Avx512bw::ExtractSum<uint32_t>(_l), h = Avx512bw::ExtractSum<uint32_t>(_h);
-                hi = (hi + h + lo*n) % 65521;
-                lo = (lo + l) % 65521;
-                b += n;
-                n = 5552;
+                s2 = _mm512_add_epi32(s2, _mm512_slli_epi32(ps, 6));
+                hi = (hi + lo * n + ExtractSum<uint32_t>(s2)) % 65521;
+                lo = (lo + ExtractSum<uint32_t>(s1)) % 65521;
+            }
+            for (; i < size; ++i)
+            {
+                lo += data[i];
+                hi += lo;
             }
-            return (hi << 16) | lo;
+            return ((hi % 65521) << 16) | (lo % 65521);
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -75,12 +73,23 @@ namespace Simd
             Array32i hashTable(ZHASH * basket);
             memset(hashTable.data, -1, hashTable.RawSize());
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            int i = Max(begin - 32768, 0), j;
+            for (; i < begin; ++i)
+            {
+                int* hList = hashTable.data + (Base::ZlibHash(data + i) & (ZHASH - 1)) * basket;
+                for (j = 0; j < basket && hList[j] != -1; ++j);
+                if (j == basket)
+                {
+                    memcpy(hList, hList + quality, quality * sizeof(int));
+                    memset(hList + quality, -1, quality * sizeof(int));
+                    j = quality;
+                }
+                hList[j] = i;
+            }
+
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
 
-            int i = 0, j;
             while (i < size - 3)
             {
                 int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
@@ -147,7 +156,16 @@ namespace Simd
             for (; i < size; ++i)
                 Base::ZlibHuffB(data[i], stream);
             Base::ZlibHuff(256, stream);
+            if (!last)
+                Base::ZlibSyncFlush(stream);
             stream.FlushBits();
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            ZlibDeflate(data, 0, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -395,6 +413,8 @@ namespace Simd
             _encode[5] = Avx512bw::EncodeLine5;
             _encode[6] = Avx512bw::EncodeLine6;
             _compress = Avx512bw::ZlibCompress;
+            _deflate = Avx512bw::ZlibDeflate;
+            _adler32 = Avx512bw::ZlibAdler32;
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
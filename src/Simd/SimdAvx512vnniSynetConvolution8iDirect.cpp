@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
@@ -62,6 +63,16 @@ namespace Simd
             else
                 return new Base::SynetConvolution8iGemmNN(param);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new Base::SynetInnerProduct8iConv(param, Avx512vnni::SynetConvolution8iInit);
+        }
     }
 #endif
 }
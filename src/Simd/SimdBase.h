@@ -36,6 +36,36 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        size_t GetLocalThreadNumber();
+
+        void SetLocalThreadNumber(size_t threadNumber);
+
+        class ThreadNumberScope
+        {
+        public:
+            ThreadNumberScope(size_t threadNumber)
+                : _old(GetLocalThreadNumber())
+                , _set(threadNumber != 0)
+            {
+                if (_set)
+                    SetLocalThreadNumber(threadNumber);
+            }
+
+            ~ThreadNumberScope()
+            {
+                if (_set)
+                    SetLocalThreadNumber(_old);
+            }
+
+        private:
+            size_t _old;
+            bool _set;
+        };
+
+        void SetExecutor(SimdExecutorFuncPtr executorFunc, void * executor);
+
+        void ParallelExecute(SimdTaskFuncPtr task, void * context, size_t number);
+
         uint32_t Crc32(const void* src, size_t size);
 
         uint32_t Crc32c(const void * src, size_t size);
@@ -606,6 +636,10 @@ namespace Simd
 
         void SynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+        bool SynetGetStrictBuffer();
+
+        void SynetSetStrictBuffer(bool strict);
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst);
             
         void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
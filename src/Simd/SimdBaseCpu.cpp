@@ -240,6 +240,50 @@ namespace Simd
 #else
 #error This platform is unsupported!
 #endif
+
+        std::string CpuModel()
+        {
+            std::string model;
+#if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+            unsigned int brand[13] = { 0 };
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0x80000000);
+            if ((unsigned int)info[0] >= 0x80000004)
+            {
+                for (int i = 0; i < 3; ++i)
+                    __cpuid((int*)brand + 4 * i, 0x80000002 + i);
+            }
+#elif defined(__GNUC__)
+            if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004)
+            {
+                for (unsigned int i = 0; i < 3; ++i)
+                    __cpuid(0x80000002 + i, brand[4 * i + 0], brand[4 * i + 1], brand[4 * i + 2], brand[4 * i + 3]);
+            }
+#endif
+            model = (char*)brand;
+#elif defined(__GNUC__) && defined(__linux__)
+            ::FILE * file = ::fopen("/proc/cpuinfo", "r");
+            if (file)
+            {
+                char buffer[1024];
+                while (model.empty() && ::fgets(buffer, sizeof(buffer), file))
+                {
+                    std::string line = buffer;
+                    if (line.find("model name") == 0 || line.find("Model") == 0 || line.find("Hardware") == 0 || line.find("cpu\t") == 0)
+                    {
+                        size_t colon = line.find(':');
+                        if (colon != std::string::npos)
+                            model = line.substr(colon + 1);
+                    }
+                }
+                ::fclose(file);
+            }
+#endif
+            size_t beg = model.find_first_not_of(" \t\r\n"), end = model.find_last_not_of(" \t\r\n");
+            model = beg == std::string::npos ? std::string("Unknown") : model.substr(beg, end - beg + 1);
+            return model;
+        }
     }
 
     namespace Cpu
@@ -25,6 +25,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdResizer.h"
 
 #include <stdio.h>
 
@@ -35,29 +36,49 @@
 
 namespace Simd
 {
-    uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    static bool ReadFile(const char* path, Array8u& buffer)
     {
-        uint8_t* data = NULL;
+        bool result = false;
         ::FILE* file = ::fopen(path, "rb");
         if (file)
         {
             ::fseek(file, 0, SEEK_END);
-            Array8u buffer(::ftell(file));
+            buffer.Resize(::ftell(file));
             ::fseek(file, 0, SEEK_SET);
-            if (::fread(buffer.data, 1, buffer.size, file) == buffer.size)
-                data = loader(buffer.data, buffer.size, stride, width, height, format);
+            result = ::fread(buffer.data, 1, buffer.size, file) == buffer.size;
             ::fclose(file);
         }
-        return data;
+        return result;
+    }
+
+    uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        Array8u buffer;
+        if (ReadFile(path, buffer))
+            return loader(buffer.data, buffer.size, stride, width, height, format);
+        return NULL;
+    }
+
+    uint8_t* ImageLoadFromFileScaled(const ImageLoadFromMemoryScaledPtr loader, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        Array8u buffer;
+        if (ReadFile(path, buffer))
+            return loader(buffer.data, buffer.size, scale, stride, width, height, format);
+        return NULL;
     }
 
     //-------------------------------------------------------------------------
 
-    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f)
+    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc)
         : data(d)
         , size(s)
         , format(f)
         , file(SimdImageFileUndefined)
+        , scale(sc)
+        , left(0)
+        , top(0)
+        , right(0)
+        , bottom(0)
     {
     }
 
@@ -90,10 +111,116 @@ namespace Simd
         }
         return
             file != SimdImageFileUndefined && 
+                (scale == 1 || scale == 2 || scale == 4 || scale == 8) && (scale == 1 || !Region()) &&
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
                 format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 || 
                 format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32);
     }
+
+    //-------------------------------------------------------------------------
+
+    bool ImageLoader::Downscale()
+    {
+        if (_param.scale == 1)
+            return true;
+        Image image(DivHi(_image.width, _param.scale), DivHi(_image.height, _param.scale), _image.format);
+        Holder<Resizer> resizer((Resizer*)Base::ResizerInit(_image.width, _image.height, image.width, image.height,
+            _image.ChannelCount(), SimdResizeChannelByte, SimdResizeMethodArea));
+        if (!resizer)
+            return false;
+        resizer->Run(_image.data, _image.stride, image.data, image.stride);
+        _image.Swap(image);
+        return true;
+    }
+
+    bool ImageLoader::Progress(const uint8_t* data, size_t size)
+    {
+        if (_ready == 0)
+        {
+            _param.data = data;
+            _param.size = size;
+            _stream = InputMemoryStream(data, size);
+            if (FromStream())
+                _ready = _image.height;
+        }
+        return true;
+    }
+
+    bool ImageLoader::Crop()
+    {
+        if (!_param.Region())
+            return true;
+        if (_param.left >= _image.width || _param.top >= _image.height)
+            return false;
+        Image region = _image.Region(_param.left, _param.top, _param.right, _param.bottom);
+        Image image(region.width, region.height, region.format);
+        Base::Copy(region.data, region.stride, region.width, region.height, region.PixelSize(), image.data, image.stride);
+        _image.Swap(image);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    ImageDecoder::ImageDecoder(SimdPixelFormatType format, CreateImageLoaderPtr create)
+        : _format(format)
+        , _create(create)
+        , _loader(NULL)
+        , _pulled(0)
+        , _error(false)
+    {
+    }
+
+    ImageDecoder::~ImageDecoder()
+    {
+        if (_loader)
+            delete _loader;
+    }
+
+    bool ImageDecoder::Push(const uint8_t* data, size_t size)
+    {
+        if (_error)
+            return false;
+        _buffer.Write(data, size);
+        if (_loader == NULL)
+        {
+            ImageLoaderParam param(_buffer.Data(), _buffer.Size(), _format);
+            if (!param.Validate())
+            {
+                const size_t SIGNATURE_MAX = 8;
+                _error = _buffer.Size() >= SIGNATURE_MAX || param.file != SimdImageFileUndefined;
+                return !_error;
+            }
+            _loader = _create(param);
+            if (_loader == NULL)
+            {
+                _error = true;
+                return false;
+            }
+        }
+        _error = !_loader->Progress(_buffer.Data(), _buffer.Size());
+        return !_error;
+    }
+
+    bool ImageDecoder::Info(size_t* width, size_t* height, SimdPixelFormatType* format) const
+    {
+        if (_loader == NULL || _loader->Current().data == NULL)
+            return false;
+        *width = _loader->Current().width;
+        *height = _loader->Current().height;
+        *format = (SimdPixelFormatType)_loader->Current().format;
+        return true;
+    }
+
+    size_t ImageDecoder::Pull(uint8_t* dst, size_t stride, size_t rows)
+    {
+        if (_loader == NULL)
+            return 0;
+        const ImageLoader::Image& image = _loader->Current();
+        rows = Min(rows, _loader->Ready() - _pulled);
+        Base::Copy(image.data + _pulled * image.stride, image.stride, image.width, rows, image.PixelSize(), dst, stride);
+        _pulled += rows;
+        return rows;
+    }
         
     namespace Base
     {
@@ -363,6 +490,45 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Downscale())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            param.left = left;
+            param.top = top;
+            param.right = right;
+            param.bottom = bottom;
+            if (param.Region() && param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Crop())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        void* ImageDecoderInit(SimdPixelFormatType format)
+        {
+            return new ImageDecoder(format, CreateImageLoader);
+        }
     }
 }
 
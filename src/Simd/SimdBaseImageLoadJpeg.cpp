@@ -25,6 +25,9 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
 
 namespace Simd
 {
@@ -316,6 +319,17 @@ namespace Simd
             int scan_n, order[4];
             int restart_interval, todo;
 
+            // downscaled decoding: log2 of scale (reconstructed blocks are (8 >> scale_shift) pixels wide)
+            int scale_shift;
+
+            // region of interest: only MCUs of window [roi_mx0, roi_mx1) x [roi_my0, roi_my1) are reconstructed
+            int roi, roi_x0, roi_y0, roi_x1, roi_y1;
+            int roi_mx0, roi_my0, roi_mx1, roi_my1;
+
+            // multithreading
+            int threads;  // number of threads used to decode image
+            int deferred; // baseline coefficients are stored and reconstructed later in parallel
+
             // kernels
             void (*idct_block_kernel)(jpeg_uc* out, int out_stride, short data[64]);
             void (*YCbCr_to_RGB_kernel)(jpeg_uc* out, const jpeg_uc* y, const jpeg_uc* pcb, const jpeg_uc* pcr, int count, int step);
@@ -843,6 +857,61 @@ namespace Simd
             }
         }
 
+        // reduced IDCT: n-point transforms of low-frequency n x n coefficients give the block downscaled in 8/n times
+        static const int jpeg__idct_reduced_4[16] =
+        {
+            1448,  1892,  1448,   784,
+            1448,   784, -1448, -1892,
+            1448,  -784, -1448,  1892,
+            1448, -1892,  1448,  -784,
+        };
+
+        static const int jpeg__idct_reduced_2[4] =
+        {
+            1448,  1448,
+            1448, -1448,
+        };
+
+        jpeg_inline static void jpeg__idct_reduced(jpeg_uc* out, int out_stride, const short* data, const int* k, int n)
+        {
+            int i, j, u, val[16];
+
+            // columns: constants scaled things up by 1<<12, keep 2 extra bits of precision
+            for (i = 0; i < n; ++i) {
+                for (j = 0; j < n; ++j) {
+                    int sum = 512;
+                    for (u = 0; u < n; ++u)
+                        sum += data[u * 8 + i] * k[j * n + u];
+                    val[j * n + i] = sum >> 10;
+                }
+            }
+
+            // rows: remove 1<<14 total with rounding and add 128 bias
+            for (j = 0; j < n; ++j, out += out_stride) {
+                for (i = 0; i < n; ++i) {
+                    int sum = (1 << 13) + (128 << 14);
+                    for (u = 0; u < n; ++u)
+                        sum += val[j * n + u] * k[i * n + u];
+                    out[i] = jpeg__clamp(sum >> 14);
+                }
+            }
+        }
+
+        static void jpeg__idct_4x4(jpeg_uc* out, int out_stride, short data[64])
+        {
+            jpeg__idct_reduced(out, out_stride, data, jpeg__idct_reduced_4, 4);
+        }
+
+        static void jpeg__idct_2x2(jpeg_uc* out, int out_stride, short data[64])
+        {
+            jpeg__idct_reduced(out, out_stride, data, jpeg__idct_reduced_2, 2);
+        }
+
+        static void jpeg__idct_1x1(jpeg_uc* out, int out_stride, short data[64])
+        {
+            out[0] = jpeg__clamp(((data[0] + 4) >> 3) + 128);
+        }
+
 #ifdef JPEG_SSE2
         // sse2 integer IDCT. not the fastest possible implementation but it
         // produces bit-identical results to the generic C version so it's
@@ -1266,72 +1335,195 @@ namespace Simd
             // since we don't even allow 1<<30 pixels
         }
 
-        static int jpeg__parse_entropy_coded_data(jpeg__jpeg* z)
+        // reconstruct block bx, by of component n
+        jpeg_inline static void jpeg__idct_component_block(jpeg__jpeg* z, short* data, int n, int bx, int by)
         {
+            int size = 8 >> z->scale_shift, stride = z->img_comp[n].w2 >> z->scale_shift;
+            z->idct_block_kernel(z->img_comp[n].data + stride * by * size + bx * size, stride, data);
+        }
+
+        // block bx, by of component n belongs to MCU window of region of interest
+        jpeg_inline static int jpeg__block_in_roi(const jpeg__jpeg* z, int n, int bx, int by)
+        {
+            return bx >= z->roi_mx0 * z->img_comp[n].h && bx < z->roi_mx1 * z->img_comp[n].h &&
+                by >= z->roi_my0 * z->img_comp[n].v && by < z->roi_my1 * z->img_comp[n].v;
+        }
+
+        // decode one baseline block: store its coefficients for deferred IDCT or reconstruct it at once
+        jpeg_inline static int jpeg__jpeg_decode_baseline_block(jpeg__jpeg* z, short* data, int n, int bx, int by)
+        {
+            int ha = z->img_comp[n].ha;
+            if (z->deferred)
+                data = z->img_comp[n].coeff + 64 * (bx + by * z->img_comp[n].coeff_w);
+            if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
+            if (!z->deferred && jpeg__block_in_roi(z, n, bx, by))
+                jpeg__idct_component_block(z, data, n, bx, by);
+            return 1;
+        }
+
+        // decode one baseline MCU: a single block for non-interleaved scan or scan_n components for interleaved one
+        jpeg_inline static int jpeg__jpeg_decode_baseline_mcu(jpeg__jpeg* z, short* data, int i, int j)
+        {
+            int k, x, y;
+            if (z->scan_n == 1)
+                return jpeg__jpeg_decode_baseline_block(z, data, z->order[0], i, j);
+            // scan an interleaved mcu... process scan_n components in order
+            for (k = 0; k < z->scan_n; ++k) {
+                int n = z->order[k];
+                // scan out an mcu's worth of this component; that's just determined
+                // by the basic H and V specified for the component
+                for (y = 0; y < z->img_comp[n].v; ++y)
+                    for (x = 0; x < z->img_comp[n].h; ++x)
+                        if (!jpeg__jpeg_decode_baseline_block(z, data, n, i * z->img_comp[n].h + x, j * z->img_comp[n].v + y)) return 0;
+            }
+            return 1;
+        }
+
+        // MCU grid of current baseline scan
+        static void jpeg__jpeg_scan_size(jpeg__jpeg* z, int* w, int* h)
+        {
+            if (z->scan_n == 1) {
+                // non-interleaved data: number of blocks to do just depends on how many actual "pixels" 
+                // this component has, independent of interleaved MCU blocking and such
+                int n = z->order[0];
+                *w = (z->img_comp[n].x + 7) >> 3;
+                *h = (z->img_comp[n].y + 7) >> 3;
+            }
+            else {
+                *w = z->img_mcu_x;
+                *h = z->img_mcu_y;
+            }
+        }
+
+        // rows [*r0, *r1) of scan grid (MCUs or blocks of non-interleaved scan) which cover region of interest
+        static void jpeg__jpeg_scan_rows(jpeg__jpeg* z, int h, int* r0, int* r1)
+        {
+            int v = z->scan_n == 1 ? z->img_comp[z->order[0]].v : 1;
+            *r0 = Simd::Min(z->roi_my0 * v, h);
+            *r1 = Simd::Min(z->roi_my1 * v, h);
+        }
+
+        // find the marker which ends entropy-coded data of the scan (restart markers are skipped, their ends are stored in starts)
+        static jpeg_uc* jpeg__find_scan_end(jpeg_uc* p, jpeg_uc* end, std::vector<jpeg_uc*>* starts)
+        {
+            while (p + 1 < end) {
+                if (p[0] != 0xff)
+                    p += 1;
+                else if (p[1] == 0xff)
+                    p += 1; // fill byte
+                else if (p[1] == 0x00)
+                    p += 2; // stuffed zero
+                else if (JPEG__RESTART(p[1])) {
+                    p += 2;
+                    if (starts)
+                        starts->push_back(p);
+                }
+                else
+                    break; // any other marker ends the scan
+            }
+            return p;
+        }
+
+        // skip the rest of the scan which lies below region of interest
+        static int jpeg__skip_scan(jpeg__jpeg* z)
+        {
+            if (z->marker != JPEG__MARKER_none && !JPEG__RESTART(z->marker))
+                return 1; // bit reader has already reached the end of the scan
+            if (z->s->io.read)
+                return 1; // can't seek in the stream: remaining data will be treated as corrupt
             jpeg__jpeg_reset(z);
-            if (!z->progressive) {
-                if (z->scan_n == 1) {
-                    int i, j;
-                    JPEG_SIMD_ALIGN(short, data[64]);
-                    int n = z->order[0];
-                    // non-interleaved data, we just need to process one block at a time,
-                    // in trivial scanline order
-                    // number of blocks to do just depends on how many actual "pixels" this
-                    // component has, independent of interleaved MCU blocking and such
-                    int w = (z->img_comp[n].x + 7) >> 3;
-                    int h = (z->img_comp[n].y + 7) >> 3;
-                    for (j = 0; j < h; ++j) {
-                        for (i = 0; i < w; ++i) {
-                            int ha = z->img_comp[n].ha;
-                            if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                            z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2, data);
-                            // every data block is an MCU, so countdown the restart interval
-                            if (--z->todo <= 0) {
-                                if (z->code_bits < 24) jpeg__grow_buffer_unsafe(z);
-                                // if it's NOT a restart, then just bail, so we get corrupt data
-                                // rather than no data
-                                if (!JPEG__RESTART(z->marker)) return 1;
-                                jpeg__jpeg_reset(z);
-                            }
+            z->s->img_buffer = jpeg__find_scan_end(z->s->img_buffer, z->s->img_buffer_end, NULL);
+            return 1;
+        }
+
+        // decode independent restart intervals of baseline scan in parallel
+        // returns -1 if entropy-coded segment does not match to restart interval (it is decoded serially in this case)
+        static int jpeg__parse_restart_intervals(jpeg__jpeg* z)
+        {
+            int w, h, r0, r1, total, count, error = 0;
+            std::vector<jpeg_uc*> starts;
+            jpeg_uc* p = z->s->img_buffer;
+            jpeg__jpeg_scan_size(z, &w, &h);
+            jpeg__jpeg_scan_rows(z, h, &r0, &r1);
+            total = w * h;
+            count = (total + z->restart_interval - 1) / z->restart_interval;
+            if (count < 2)
+                return -1;
+
+            // find start of each restart interval and end of the scan
+            starts.reserve(count);
+            starts.push_back(p);
+            p = jpeg__find_scan_end(p, z->s->img_buffer_end, &starts);
+            if ((int)starts.size() < count)
+                return -1;
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t finish)
+            {
+                JPEG_SIMD_ALIGN(short, data[64]);
+                jpeg__context s = *z->s;
+                jpeg__jpeg * j = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
+                if (j == NULL) {
+                    error = 1;
+                    return;
+                }
+                *j = *z;
+                j->s = &s;
+                for (size_t r = begin; r < finish && !error; ++r) {
+                    int m = (int)r * z->restart_interval, m_end = Simd::Min(m + z->restart_interval, total);
+                    if ((m_end - 1) / w < r0 || m / w >= r1)
+                        continue; // interval doesn't intersect region of interest
+                    s.img_buffer = starts[r];
+                    jpeg__jpeg_reset(j);
+                    for (; m < m_end; ++m) {
+                        if (!jpeg__jpeg_decode_baseline_mcu(j, data, m % w, m / w)) {
+                            error = 1;
+                            break;
                         }
                     }
-                    return 1;
                 }
-                else { // interleaved
-                    int i, j, k, x, y;
-                    JPEG_SIMD_ALIGN(short, data[64]);
-                    for (j = 0; j < z->img_mcu_y; ++j) {
-                        for (i = 0; i < z->img_mcu_x; ++i) {
-                            // scan an interleaved mcu... process scan_n components in order
-                            for (k = 0; k < z->scan_n; ++k) {
-                                int n = z->order[k];
-                                // scan out an mcu's worth of this component; that's just determined
-                                // by the basic H and V specified for the component
-                                for (y = 0; y < z->img_comp[n].v; ++y) {
-                                    for (x = 0; x < z->img_comp[n].h; ++x) {
-                                        int x2 = (i * z->img_comp[n].h + x) * 8;
-                                        int y2 = (j * z->img_comp[n].v + y) * 8;
-                                        int ha = z->img_comp[n].ha;
-                                        if (!jpeg__jpeg_decode_block(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->fast_ac[ha], n, z->dequant[z->img_comp[n].tq])) return 0;
-                                        z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2, data);
-                                    }
-                                }
-                            }
-                            // after all interleaved components, that's an interleaved MCU,
-                            // so now count down the restart interval
-                            if (--z->todo <= 0) {
-                                if (z->code_bits < 24) jpeg__grow_buffer_unsafe(z);
-                                if (!JPEG__RESTART(z->marker)) return 1;
-                                jpeg__jpeg_reset(z);
-                            }
+                JPEG_FREE(j);
+            }, z->threads);
+            if (error)
+                return 0;
+
+            // continue parsing from the marker which ends the scan
+            jpeg__jpeg_reset(z);
+            z->s->img_buffer = p;
+            return 1;
+        }
+
+        static int jpeg__parse_entropy_coded_data(jpeg__jpeg* z)
+        {
+            jpeg__jpeg_reset(z);
+            if (!z->progressive) {
+                int i, j, w, h, r0, r1;
+                JPEG_SIMD_ALIGN(short, data[64]);
+                if (z->restart_interval && z->threads > 1 && z->s->io.read == NULL) {
+                    int result = jpeg__parse_restart_intervals(z);
+                    if (result >= 0)
+                        return result;
+                }
+                jpeg__jpeg_scan_size(z, &w, &h);
+                jpeg__jpeg_scan_rows(z, h, &r0, &r1);
+                for (j = 0; j < r1; ++j) {
+                    for (i = 0; i < w; ++i) {
+                        if (!jpeg__jpeg_decode_baseline_mcu(z, data, i, j)) return 0;
+                        // after all interleaved components, that's an MCU,
+                        // so now count down the restart interval
+                        if (--z->todo <= 0) {
+                            if (z->code_bits < 24) jpeg__grow_buffer_unsafe(z);
+                            // if it's NOT a restart, then just bail, so we get corrupt data
+                            // rather than no data
+                            if (!JPEG__RESTART(z->marker)) return 1;
+                            jpeg__jpeg_reset(z);
                         }
                     }
-                    return 1;
                 }
+                return r1 < h ? jpeg__skip_scan(z) : 1;
             }
             else {
                 if (z->scan_n == 1) {
-                    int i, j;
+                    int i, j, r0, r1;
                     int n = z->order[0];
                     // non-interleaved data, we just need to process one block at a time,
                     // in trivial scanline order
@@ -1339,7 +1531,8 @@ namespace Simd
                     // component has, independent of interleaved MCU blocking and such
                     int w = (z->img_comp[n].x + 7) >> 3;
                     int h = (z->img_comp[n].y + 7) >> 3;
-                    for (j = 0; j < h; ++j) {
+                    jpeg__jpeg_scan_rows(z, h, &r0, &r1);
+                    for (j = 0; j < r1; ++j) {
                         for (i = 0; i < w; ++i) {
                             short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
                             if (z->spec_start == 0) {
@@ -1359,11 +1552,12 @@ namespace Simd
                             }
                         }
                     }
-                    return 1;
+                    return r1 < h ? jpeg__skip_scan(z) : 1;
                 }
                 else { // interleaved
-                    int i, j, k, x, y;
-                    for (j = 0; j < z->img_mcu_y; ++j) {
+                    int i, j, k, x, y, r0, r1;
+                    jpeg__jpeg_scan_rows(z, z->img_mcu_y, &r0, &r1);
+                    for (j = 0; j < r1; ++j) {
                         for (i = 0; i < z->img_mcu_x; ++i) {
                             // scan an interleaved mcu... process scan_n components in order
                             for (k = 0; k < z->scan_n; ++k) {
@@ -1389,7 +1583,7 @@ namespace Simd
                             }
                         }
                     }
-                    return 1;
+                    return r1 < z->img_mcu_y ? jpeg__skip_scan(z) : 1;
                 }
             }
         }
@@ -1403,19 +1597,23 @@ namespace Simd
 
         static void jpeg__jpeg_finish(jpeg__jpeg* z)
         {
-            if (z->progressive) {
-                // dequantize and idct the data
-                int i, j, n;
+            if (z->progressive || z->deferred) {
+                // dequantize and idct the data (baseline coefficients are already dequantized)
+                int n;
                 for (n = 0; n < z->s->img_n; ++n) {
-                    int w = (z->img_comp[n].x + 7) >> 3;
-                    int h = (z->img_comp[n].y + 7) >> 3;
-                    for (j = 0; j < h; ++j) {
-                        for (i = 0; i < w; ++i) {
-                            short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
-                            jpeg__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
-                            z->idct_block_kernel(z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2, data);
+                    int w = Simd::Min((z->img_comp[n].x + 7) >> 3, z->roi_mx1 * z->img_comp[n].h);
+                    int h = Simd::Min((z->img_comp[n].y + 7) >> 3, z->roi_my1 * z->img_comp[n].v);
+                    Simd::Parallel(z->roi_my0 * z->img_comp[n].v, h, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t j = begin; j < end; ++j) {
+                            for (int i = z->roi_mx0 * z->img_comp[n].h; i < w; ++i) {
+                                short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeff_w);
+                                if (z->progressive)
+                                    jpeg__jpeg_dequantize(data, z->dequant[z->img_comp[n].tq]);
+                                jpeg__idct_component_block(z, data, n, i, (int)j);
+                            }
                         }
-                    }
+                    }, z->threads);
                 }
             }
         }
@@ -1623,6 +1821,9 @@ namespace Simd
 
             if (!jpeg__mad3sizes_valid(s->img_x, s->img_y, s->img_n, 0)) return jpeg__err("too large", "Image too large to decode");
 
+            // without restart markers entropy decoding of baseline image is serial, but IDCT can be done in parallel
+            z->deferred = z->threads > 1 && !z->progressive && !z->restart_interval;
+
             for (i = 0; i < s->img_n; ++i) {
                 if (z->img_comp[i].h > h_max) h_max = z->img_comp[i].h;
                 if (z->img_comp[i].v > v_max) v_max = z->img_comp[i].v;
@@ -1637,6 +1838,23 @@ namespace Simd
             z->img_mcu_x = (s->img_x + z->img_mcu_w - 1) / z->img_mcu_w;
             z->img_mcu_y = (s->img_y + z->img_mcu_h - 1) / z->img_mcu_h;
 
+            // MCU window of region of interest: one extra MCU at each side gives exact upsampling of chroma at its borders
+            if (z->roi) {
+                z->roi_x1 = Simd::Min(z->roi_x1, (int)s->img_x);
+                z->roi_y1 = Simd::Min(z->roi_y1, (int)s->img_y);
+                if (z->roi_x0 >= z->roi_x1 || z->roi_y0 >= z->roi_y1) return jpeg__err("bad ROI", "Region of interest is out of image");
+                z->roi_mx0 = Simd::Max(z->roi_x0 / z->img_mcu_w - 1, 0);
+                z->roi_my0 = Simd::Max(z->roi_y0 / z->img_mcu_h - 1, 0);
+                z->roi_mx1 = Simd::Min((z->roi_x1 + z->img_mcu_w - 1) / z->img_mcu_w + 1, z->img_mcu_x);
+                z->roi_my1 = Simd::Min((z->roi_y1 + z->img_mcu_h - 1) / z->img_mcu_h + 1, z->img_mcu_y);
+            }
+            else {
+                z->roi_mx0 = 0;
+                z->roi_my0 = 0;
+                z->roi_mx1 = z->img_mcu_x;
+                z->roi_my1 = z->img_mcu_y;
+            }
+
             for (i = 0; i < s->img_n; ++i) {
                 // number of effective pixels (e.g. for non-interleaved MCU)
                 z->img_comp[i].x = (s->img_x * z->img_comp[i].h + h_max - 1) / h_max;
@@ -1653,12 +1871,12 @@ namespace Simd
                 z->img_comp[i].coeff = 0;
                 z->img_comp[i].raw_coeff = 0;
                 z->img_comp[i].linebuf = NULL;
-                z->img_comp[i].raw_data = jpeg__malloc_mad2(z->img_comp[i].w2, z->img_comp[i].h2, 15);
+                z->img_comp[i].raw_data = jpeg__malloc_mad2(z->img_comp[i].w2 >> z->scale_shift, z->img_comp[i].h2 >> z->scale_shift, 15);
                 if (z->img_comp[i].raw_data == NULL)
                     return jpeg__free_jpeg_components(z, i + 1, jpeg__err("outofmem", "Out of memory"));
                 // align blocks for idct using mmx/sse
                 z->img_comp[i].data = (jpeg_uc*)(((size_t)z->img_comp[i].raw_data + 15) & ~15);
-                if (z->progressive) {
+                if (z->progressive || z->deferred) {
                     // w2, h2 are multiples of 8 (see above)
                     z->img_comp[i].coeff_w = z->img_comp[i].w2 / 8;
                     z->img_comp[i].coeff_h = z->img_comp[i].h2 / 8;
@@ -1743,8 +1961,7 @@ namespace Simd
                 }
                 m = jpeg__get_marker(j);
             }
-            if (j->progressive)
-                jpeg__jpeg_finish(j);
+            jpeg__jpeg_finish(j);
             return 1;
         }
 
@@ -2139,6 +2356,12 @@ namespace Simd
             j->YCbCr_to_RGB_kernel = jpeg__YCbCr_to_RGB_simd;
             j->resample_row_hv_2_kernel = jpeg__resample_row_hv_2_simd;
 #endif
+
+            switch (j->scale_shift) {
+            case 1: j->idct_block_kernel = jpeg__idct_4x4; break;
+            case 2: j->idct_block_kernel = jpeg__idct_2x2; break;
+            case 3: j->idct_block_kernel = jpeg__idct_1x1; break;
+            }
         }
 
         // clean up the temporary component buffers
@@ -2164,9 +2387,173 @@ namespace Simd
             return (jpeg_uc)((t + (t >> 8)) >> 8);
         }
 
+        // resample and color-convert image rows in range [begin, end)
+        // resample rows [begin, end) and convert columns [x0, x0 + width) of them to output (it points to the row begin)
+        static void jpeg__resample_rows(jpeg__jpeg* z, const jpeg__resample* res_comp, jpeg_uc* linebuf, jpeg_uc* rowbuf, int decode_n, int n, int is_rgb, 
+            jpeg_uc* output, unsigned int x0, unsigned int width, unsigned int begin, unsigned int end)
+        {
+            int k;
+            unsigned int i, j;
+            jpeg_uc* coutput[4] = { NULL, NULL, NULL, NULL };
+            jpeg__resample res[4];
+
+            // restore state of vertical resampling at the first row of the range
+            for (k = 0; k < decode_n; ++k) {
+                jpeg__resample* r = &res[k];
+                int steps = (res_comp[k].vs >> 1) + (int)begin;
+                int wraps = steps / res_comp[k].vs;
+                *r = res_comp[k];
+                r->ystep = steps % r->vs;
+                r->ypos = wraps;
+                r->line0 = z->img_comp[k].data + Simd::Min(Simd::Max(wraps - 1, 0), z->img_comp[k].y - 1) * z->img_comp[k].w2;
+                r->line1 = z->img_comp[k].data + Simd::Min(wraps, z->img_comp[k].y - 1) * z->img_comp[k].w2;
+            }
+
+            for (j = begin; j < end; ++j) {
+                // the last row of the range is converted to separate buffer: converters write one byte over the row end
+                int tail = j + 1 == end;
+                jpeg_uc* out = tail ? rowbuf : output + n * width * (j - begin);
+                for (k = 0; k < decode_n; ++k) {
+                    jpeg__resample* r = &res[k];
+                    int y_bot = r->ystep >= (r->vs >> 1);
+                    coutput[k] = r->resample(linebuf + k * (z->s->img_x + 3),
+                        y_bot ? r->line1 : r->line0,
+                        y_bot ? r->line0 : r->line1,
+                        r->w_lores, r->hs);
+                    if (++r->ystep >= r->vs) {
+                        r->ystep = 0;
+                        r->line0 = r->line1;
+                        if (++r->ypos < z->img_comp[k].y)
+                            r->line1 += z->img_comp[k].w2;
+                    }
+                    coutput[k] += x0;
+                }
+                if (n >= 3) {
+                    jpeg_uc* y = coutput[0];
+                    if (z->s->img_n == 3) {
+                        if (is_rgb) {
+                            for (i = 0; i < width; ++i) {
+                                out[0] = y[i];
+                                out[1] = coutput[1][i];
+                                out[2] = coutput[2][i];
+                                out[3] = 255;
+                                out += n;
+                            }
+                        }
+                        else {
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
+                        }
+                    }
+                    else if (z->s->img_n == 4) {
+                        if (z->app14_color_transform == 0) { // CMYK
+                            for (i = 0; i < width; ++i) {
+                                jpeg_uc m = coutput[3][i];
+                                out[0] = jpeg__blinn_8x8(coutput[0][i], m);
+                                out[1] = jpeg__blinn_8x8(coutput[1][i], m);
+                                out[2] = jpeg__blinn_8x8(coutput[2][i], m);
+                                out[3] = 255;
+                                out += n;
+                            }
+                        }
+                        else if (z->app14_color_transform == 2) { // YCCK
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
+                            for (i = 0; i < width; ++i) {
+                                jpeg_uc m = coutput[3][i];
+                                out[0] = jpeg__blinn_8x8(255 - out[0], m);
+                                out[1] = jpeg__blinn_8x8(255 - out[1], m);
+                                out[2] = jpeg__blinn_8x8(255 - out[2], m);
+                                out += n;
+                            }
+                        }
+                        else { // YCbCr + alpha?  Ignore the fourth channel for now
+                            z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], width, n);
+                        }
+                    }
+                    else
+                        for (i = 0; i < width; ++i) {
+                            out[0] = out[1] = out[2] = y[i];
+                            out[3] = 255; // not used if n==3
+                            out += n;
+                        }
+                }
+                else {
+                    if (is_rgb) {
+                        if (n == 1)
+                            for (i = 0; i < width; ++i)
+                                *out++ = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+                        else {
+                            for (i = 0; i < width; ++i, out += 2) {
+                                out[0] = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
+                                out[1] = 255;
+                            }
+                        }
+                    }
+                    else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
+                        for (i = 0; i < width; ++i) {
+                            jpeg_uc m = coutput[3][i];
+                            jpeg_uc r = jpeg__blinn_8x8(coutput[0][i], m);
+                            jpeg_uc g = jpeg__blinn_8x8(coutput[1][i], m);
+                            jpeg_uc b = jpeg__blinn_8x8(coutput[2][i], m);
+                            out[0] = jpeg__compute_y(r, g, b);
+                            out[1] = 255;
+                            out += n;
+                        }
+                    }
+                    else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
+                        for (i = 0; i < width; ++i) {
+                            out[0] = jpeg__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
+                            out[1] = 255;
+                            out += n;
+                        }
+                    }
+                    else {
+                        jpeg_uc* y = coutput[0];
+                        if (n == 1)
+                            for (i = 0; i < width; ++i) out[i] = y[i];
+                        else
+                            for (i = 0; i < width; ++i) { *out++ = y[i]; *out++ = 255; }
+                    }
+                }
+                if (tail)
+                    memcpy(output + n * width * (j - begin), rowbuf, n * width);
+            }
+        }
+
+        // determine actual number of components to generate and setup resampling of component planes
+        static void jpeg__setup_resample(jpeg__jpeg* z, int req_comp, jpeg__resample* res_comp, int* n, int* decode_n, int* is_rgb)
+        {
+            int k;
+            *n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
+
+            *is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
+
+            if (z->s->img_n == 3 && *n < 3 && !*is_rgb)
+                *decode_n = 1;
+            else
+                *decode_n = z->s->img_n;
+
+            for (k = 0; k < *decode_n; ++k) {
+                jpeg__resample* r = &res_comp[k];
+
+                r->hs = z->img_h_max / z->img_comp[k].h;
+                r->vs = z->img_v_max / z->img_comp[k].v;
+                r->ystep = r->vs >> 1;
+                r->w_lores = (z->s->img_x + r->hs - 1) / r->hs;
+                r->ypos = 0;
+                r->line0 = r->line1 = z->img_comp[k].data;
+
+                if (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
+                else if (r->hs == 1 && r->vs == 2) r->resample = jpeg__resample_row_v_2;
+                else if (r->hs == 2 && r->vs == 1) r->resample = jpeg__resample_row_h_2;
+                else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
+                else                               r->resample = jpeg__resample_row_generic;
+            }
+        }
+
         static jpeg_uc* load_jpeg_image(jpeg__jpeg* z, int* out_x, int* out_y, int* comp, int req_comp)
         {
             int n, decode_n, is_rgb;
+            jpeg__resample res_comp[4];
             z->s->img_n = 0; // make jpeg__cleanup_jpeg safe
 
             // validate req_comp
@@ -2175,169 +2562,99 @@ namespace Simd
             // load a jpeg image from whichever source, but leave in YCbCr format
             if (!jpeg__decode_jpeg_image(z)) { jpeg__cleanup_jpeg(z); return NULL; }
 
-            // determine actual number of components to generate
-            n = req_comp ? req_comp : z->s->img_n >= 3 ? 3 : 1;
+            // reduced IDCT has given downscaled component planes
+            if (z->scale_shift) {
+                int k, add = (1 << z->scale_shift) - 1;
+                z->s->img_x = (z->s->img_x + add) >> z->scale_shift;
+                z->s->img_y = (z->s->img_y + add) >> z->scale_shift;
+                for (k = 0; k < z->s->img_n; ++k) {
+                    z->img_comp[k].x = (z->img_comp[k].x + add) >> z->scale_shift;
+                    z->img_comp[k].y = (z->img_comp[k].y + add) >> z->scale_shift;
+                    z->img_comp[k].w2 >>= z->scale_shift;
+                    z->img_comp[k].h2 >>= z->scale_shift;
+                }
+            }
 
-            is_rgb = z->s->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
+            // region of interest: resample only MCU window around it and convert only its pixels
+            if (z->roi) {
+                int k, wx0 = z->roi_mx0 * z->img_mcu_w, wy0 = z->roi_my0 * z->img_mcu_h;
+                int wx1 = Simd::Min(z->roi_mx1 * z->img_mcu_w, (int)z->s->img_x);
+                int wy1 = Simd::Min(z->roi_my1 * z->img_mcu_h, (int)z->s->img_y);
+                for (k = 0; k < z->s->img_n; ++k) {
+                    int cx0 = wx0 * z->img_comp[k].h / z->img_h_max, cy0 = wy0 * z->img_comp[k].v / z->img_v_max;
+                    int cx1 = (wx1 * z->img_comp[k].h + z->img_h_max - 1) / z->img_h_max;
+                    int cy1 = (wy1 * z->img_comp[k].v + z->img_v_max - 1) / z->img_v_max;
+                    z->img_comp[k].data += cy0 * z->img_comp[k].w2 + cx0;
+                    z->img_comp[k].x = cx1 - cx0;
+                    z->img_comp[k].y = cy1 - cy0;
+                }
+                z->s->img_x = wx1 - wx0;
+                z->s->img_y = wy1 - wy0;
+                z->roi_x0 -= wx0;
+                z->roi_x1 -= wx0;
+                z->roi_y0 -= wy0;
+                z->roi_y1 -= wy0;
+            }
+            else {
+                z->roi_x0 = 0;
+                z->roi_y0 = 0;
+                z->roi_x1 = z->s->img_x;
+                z->roi_y1 = z->s->img_y;
+            }
 
-            if (z->s->img_n == 3 && n < 3 && !is_rgb)
-                decode_n = 1;
-            else
-                decode_n = z->s->img_n;
+            jpeg__setup_resample(z, req_comp, res_comp, &n, &decode_n, &is_rgb);
 
             // resample and color-convert
             {
-                int k;
-                unsigned int i, j;
                 jpeg_uc* output;
-                jpeg_uc* coutput[4] = { NULL, NULL, NULL, NULL };
-
-                jpeg__resample res_comp[4];
-
-                for (k = 0; k < decode_n; ++k) {
-                    jpeg__resample* r = &res_comp[k];
-
-                    // allocate line buffer big enough for upsampling off the edges
-                    // with upsample factor of 4
-                    z->img_comp[k].linebuf = (jpeg_uc*)jpeg__malloc(z->s->img_x + 3);
-                    if (!z->img_comp[k].linebuf) { jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
-
-                    r->hs = z->img_h_max / z->img_comp[k].h;
-                    r->vs = z->img_v_max / z->img_comp[k].v;
-                    r->ystep = r->vs >> 1;
-                    r->w_lores = (z->s->img_x + r->hs - 1) / r->hs;
-                    r->ypos = 0;
-                    r->line0 = r->line1 = z->img_comp[k].data;
-
-                    if (r->hs == 1 && r->vs == 1) r->resample = resample_row_1;
-                    else if (r->hs == 1 && r->vs == 2) r->resample = jpeg__resample_row_v_2;
-                    else if (r->hs == 2 && r->vs == 1) r->resample = jpeg__resample_row_h_2;
-                    else if (r->hs == 2 && r->vs == 2) r->resample = z->resample_row_hv_2_kernel;
-                    else                               r->resample = jpeg__resample_row_generic;
-                }
 
                 // can't error after this so, this is safe
-                output = (jpeg_uc*)jpeg__malloc_mad3(n, z->s->img_x, z->s->img_y, 1);
+                output = (jpeg_uc*)jpeg__malloc_mad3(n, z->roi_x1 - z->roi_x0, z->roi_y1 - z->roi_y0, 1);
                 if (!output) { jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
 
-                // now go ahead and resample
-                for (j = 0; j < z->s->img_y; ++j) {
-                    jpeg_uc* out = output + n * z->s->img_x * j;
-                    for (k = 0; k < decode_n; ++k) {
-                        jpeg__resample* r = &res_comp[k];
-                        int y_bot = r->ystep >= (r->vs >> 1);
-                        coutput[k] = r->resample(z->img_comp[k].linebuf,
-                            y_bot ? r->line1 : r->line0,
-                            y_bot ? r->line0 : r->line1,
-                            r->w_lores, r->hs);
-                        if (++r->ystep >= r->vs) {
-                            r->ystep = 0;
-                            r->line0 = r->line1;
-                            if (++r->ypos < z->img_comp[k].y)
-                                r->line1 += z->img_comp[k].w2;
-                        }
-                    }
-                    if (n >= 3) {
-                        jpeg_uc* y = coutput[0];
-                        if (z->s->img_n == 3) {
-                            if (is_rgb) {
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    out[0] = y[i];
-                                    out[1] = coutput[1][i];
-                                    out[2] = coutput[2][i];
-                                    out[3] = 255;
-                                    out += n;
-                                }
-                            }
-                            else {
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                            }
-                        }
-                        else if (z->s->img_n == 4) {
-                            if (z->app14_color_transform == 0) { // CMYK
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    jpeg_uc m = coutput[3][i];
-                                    out[0] = jpeg__blinn_8x8(coutput[0][i], m);
-                                    out[1] = jpeg__blinn_8x8(coutput[1][i], m);
-                                    out[2] = jpeg__blinn_8x8(coutput[2][i], m);
-                                    out[3] = 255;
-                                    out += n;
-                                }
-                            }
-                            else if (z->app14_color_transform == 2) { // YCCK
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                                for (i = 0; i < z->s->img_x; ++i) {
-                                    jpeg_uc m = coutput[3][i];
-                                    out[0] = jpeg__blinn_8x8(255 - out[0], m);
-                                    out[1] = jpeg__blinn_8x8(255 - out[1], m);
-                                    out[2] = jpeg__blinn_8x8(255 - out[2], m);
-                                    out += n;
-                                }
-                            }
-                            else { // YCbCr + alpha?  Ignore the fourth channel for now
-                                z->YCbCr_to_RGB_kernel(out, y, coutput[1], coutput[2], z->s->img_x, n);
-                            }
-                        }
-                        else
-                            for (i = 0; i < z->s->img_x; ++i) {
-                                out[0] = out[1] = out[2] = y[i];
-                                out[3] = 255; // not used if n==3
-                                out += n;
-                            }
-                    }
-                    else {
-                        if (is_rgb) {
-                            if (n == 1)
-                                for (i = 0; i < z->s->img_x; ++i)
-                                    *out++ = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                            else {
-                                for (i = 0; i < z->s->img_x; ++i, out += 2) {
-                                    out[0] = jpeg__compute_y(coutput[0][i], coutput[1][i], coutput[2][i]);
-                                    out[1] = 255;
-                                }
-                            }
-                        }
-                        else if (z->s->img_n == 4 && z->app14_color_transform == 0) {
-                            for (i = 0; i < z->s->img_x; ++i) {
-                                jpeg_uc m = coutput[3][i];
-                                jpeg_uc r = jpeg__blinn_8x8(coutput[0][i], m);
-                                jpeg_uc g = jpeg__blinn_8x8(coutput[1][i], m);
-                                jpeg_uc b = jpeg__blinn_8x8(coutput[2][i], m);
-                                out[0] = jpeg__compute_y(r, g, b);
-                                out[1] = 255;
-                                out += n;
-                            }
-                        }
-                        else if (z->s->img_n == 4 && z->app14_color_transform == 2) {
-                            for (i = 0; i < z->s->img_x; ++i) {
-                                out[0] = jpeg__blinn_8x8(255 - coutput[0][i], coutput[3][i]);
-                                out[1] = 255;
-                                out += n;
-                            }
-                        }
-                        else {
-                            jpeg_uc* y = coutput[0];
-                            if (n == 1)
-                                for (i = 0; i < z->s->img_x; ++i) out[i] = y[i];
-                            else
-                                for (i = 0; i < z->s->img_x; ++i) { *out++ = y[i]; *out++ = 255; }
+                // now go ahead and resample, each thread uses its own line buffers
+                {
+                    int error = 0;
+                    Simd::Parallel(z->roi_y0, z->roi_y1, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        // allocate line buffer big enough for upsampling off the edges
+                        // with upsample factor of 4
+                        // and one output row with extra byte
+                        jpeg_uc* linebuf = (jpeg_uc*)jpeg__malloc_mad2(decode_n + n, z->s->img_x + 3, 0);
+                        if (linebuf == NULL) {
+                            error = 1;
+                            return;
                         }
-                    }
+                        jpeg__resample_rows(z, res_comp, linebuf, linebuf + decode_n * (z->s->img_x + 3), decode_n, n, is_rgb,
+                            output + n * (z->roi_x1 - z->roi_x0) * (begin - z->roi_y0), z->roi_x0, z->roi_x1 - z->roi_x0, (unsigned int)begin, (unsigned int)end);
+                        JPEG_FREE(linebuf);
+                    }, z->threads, z->img_mcu_h);
+                    if (error) { JPEG_FREE(output); jpeg__cleanup_jpeg(z); return jpeg__errpuc("outofmem", "Out of memory"); }
                 }
                 jpeg__cleanup_jpeg(z);
-                *out_x = z->s->img_x;
-                *out_y = z->s->img_y;
+                *out_x = z->roi_x1 - z->roi_x0;
+                *out_y = z->roi_y1 - z->roi_y0;
                 if (comp) *comp = z->s->img_n >= 3 ? 3 : 1; // report original components, not output
                 return output;
             }
         }
 
-        static void* jpeg__jpeg_load(jpeg__context* s, int* x, int* y, int* comp, int req_comp, jpeg__result_info* ri)
+        static void* jpeg__jpeg_load(jpeg__context* s, int* x, int* y, int* comp, int req_comp, int scale_shift, const int* roi, jpeg__result_info* ri)
         {
             unsigned char* result;
             jpeg__jpeg* j = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
             JPEG_NOTUSED(ri);
             j->s = s;
+            j->threads = (int)Base::GetThreadNumber();
+            j->deferred = 0;
+            j->scale_shift = scale_shift;
+            j->roi = roi ? 1 : 0;
+            if (roi) {
+                j->roi_x0 = roi[0];
+                j->roi_y0 = roi[1];
+                j->roi_x1 = roi[2];
+                j->roi_y1 = roi[3];
+            }
             jpeg__setup_jpeg(j);
             result = load_jpeg_image(j, x, y, comp, req_comp);
             JPEG_FREE(j);
@@ -2349,6 +2666,8 @@ namespace Simd
             int r;
             jpeg__jpeg* j = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
             j->s = s;
+            j->scale_shift = 0;
+            j->roi = 0;
             jpeg__setup_jpeg(j);
             r = jpeg__decode_jpeg_header(j, JPEG__SCAN_type);
             jpeg__rewind(s);
@@ -2380,77 +2699,284 @@ namespace Simd
 
         //------------------------------------------------------------------------
 
-        static int jpeg__stdio_read(void* user, char* data, int size)
+        // incremental decoding: parse all headers up to the first scan
+        static int jpeg__stream_header(jpeg__jpeg* z)
         {
-            InputMemoryStream* stream = (InputMemoryStream*)user;
-            return (int)stream->Read(size, data);
+            int m;
+            for (m = 0; m < 4; m++) {
+                z->img_comp[m].raw_data = NULL;
+                z->img_comp[m].raw_coeff = NULL;
+                z->img_comp[m].linebuf = NULL;
+            }
+            z->s->img_n = 0;
+            z->restart_interval = 0;
+            if (!jpeg__decode_jpeg_header(z, JPEG__SCAN_load)) return 0;
+            m = jpeg__get_marker(z);
+            while (!jpeg__SOS(m)) {
+                if (jpeg__EOI(m) || !jpeg__process_marker(z, m)) return 0;
+                m = jpeg__get_marker(z);
+            }
+            return jpeg__process_scan_header(z);
         }
 
-        static void jpeg__stdio_skip(void* user, int n)
+        // state of bit reader at the beginning of MCU row
+        typedef struct
         {
-            InputMemoryStream* stream = (InputMemoryStream*)user;
-            stream->Skip(n);
+            jpeg_uc* img_buffer;
+            jpeg__uint32 code_buffer;
+            int code_bits, nomore, todo, dc_pred[4];
+            unsigned char marker;
+        } jpeg__bit_state;
+
+        static void jpeg__save_bit_state(const jpeg__jpeg* z, jpeg__bit_state* b)
+        {
+            b->img_buffer = z->s->img_buffer;
+            b->code_buffer = z->code_buffer;
+            b->code_bits = z->code_bits;
+            b->nomore = z->nomore;
+            b->todo = z->todo;
+            b->marker = z->marker;
+            for (int k = 0; k < 4; ++k)
+                b->dc_pred[k] = z->img_comp[k].dc_pred;
+        }
+
+        static void jpeg__load_bit_state(jpeg__jpeg* z, const jpeg__bit_state* b)
+        {
+            z->s->img_buffer = b->img_buffer;
+            z->code_buffer = b->code_buffer;
+            z->code_bits = b->code_bits;
+            z->nomore = b->nomore;
+            z->todo = b->todo;
+            z->marker = b->marker;
+            for (int k = 0; k < 4; ++k)
+                z->img_comp[k].dc_pred = b->dc_pred[k];
+        }
+
+        // incremental decoding: decode MCU row j of baseline interleaved scan
+        // returns 1 - row is decoded, 0 - error, -1 - row is incomplete (more data is needed), 2 - scan is ended
+        static int jpeg__stream_mcu_row(jpeg__jpeg* z, int j)
+        {
+            int i, result = 1;
+            jpeg__bit_state state;
+            JPEG_SIMD_ALIGN(short, data[64]);
+            jpeg__save_bit_state(z, &state);
+            for (i = 0; i < z->img_mcu_x && result == 1; ++i) {
+                if (!jpeg__jpeg_decode_baseline_mcu(z, data, i, j)) 
+                    result = 0;
+                else if (--z->todo <= 0) {
+                    if (z->code_bits < 24) jpeg__grow_buffer_unsafe(z);
+                    if (!JPEG__RESTART(z->marker)) 
+                        result = 2;
+                    else
+                        jpeg__jpeg_reset(z);
+                }
+            }
+            // the bit reader has taken zeros instead of the absent data
+            if (z->s->img_buffer >= z->s->img_buffer_end && !z->nomore) {
+                jpeg__load_bit_state(z, &state);
+                return -1;
+            }
+            return result;
         }
 
-        static int jpeg__stdio_eof(void* user)
+        static void jpeg__rgb_to_image(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType format, uint8_t* dst, size_t dstStride)
         {
-            InputMemoryStream* stream = (InputMemoryStream*)user;
-            return stream->Pos() == stream->Size() ? 1 : 0;
+            switch (format)
+            {
+            case SimdPixelFormatGray8:
+                Base::RgbToGray(src, width, height, stride, dst, dstStride);
+                break;
+            case SimdPixelFormatBgr24:
+                Base::BgrToRgb(src, width, height, stride, dst, dstStride);
+                break;
+            case SimdPixelFormatBgra32:
+                Base::RgbToBgra(src, width, height, stride, dst, dstStride, 0xFF);
+                break;
+            case SimdPixelFormatRgb24:
+                Base::Copy(src, stride, width, height, 3, dst, dstStride);
+                break;
+            case SimdPixelFormatRgba32:
+                Base::BgrToBgra(src, width, height, stride, dst, dstStride, 0xFF);
+                break;
+            default:
+                break;
+            }
         }
 
-        //---------------------------------------------------------------------
+        //------------------------------------------------------------------------
+
+        struct ImageJpegLoader::Decoder
+        {
+            enum Stage
+            {
+                StageHeader,
+                StageScan,
+                StageWhole,
+                StageDone,
+            } stage;
+            jpeg__context s;
+            jpeg__jpeg* z;
+            jpeg__resample res_comp[4];
+            int n, decode_n, is_rgb, rows;
+            Array8u buffer;
+
+            Decoder()
+                : stage(StageHeader)
+                , z(NULL)
+                , rows(0)
+            {
+                memset(&s, 0, sizeof(s));
+            }
+
+            ~Decoder()
+            {
+                if (z)
+                {
+                    jpeg__cleanup_jpeg(z);
+                    JPEG_FREE(z);
+                }
+            }
+        };
 
         ImageJpegLoader::ImageJpegLoader(const ImageLoaderParam& param)
             : ImageLoader(param)
+            , _decoder(NULL)
         {
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgb24;
         }
 
+        ImageJpegLoader::~ImageJpegLoader()
+        {
+            if (_decoder)
+                delete _decoder;
+        }
+
         bool ImageJpegLoader::FromStream()
         {
             int x, y, comp;
             jpeg__context s;
-            s.io.eof = jpeg__stdio_eof;
-            s.io.read = jpeg__stdio_read;
-            s.io.skip = jpeg__stdio_skip;
-            s.io_user_data = &_stream;
-            s.buflen = sizeof(s.buffer_start);
-            s.read_from_callbacks = 1;
-            s.callback_already_read = 0;
-            s.img_buffer = s.img_buffer_original = s.buffer_start;
-            jpeg__refill_buffer(&s);
-            s.img_buffer_original_end = s.img_buffer_end;
+            // whole image is in memory: it allows to decode restart intervals in parallel
+            memset(&s, 0, sizeof(s));
+            s.img_buffer = s.img_buffer_original = (jpeg_uc*)_stream.Current();
+            s.img_buffer_end = s.img_buffer_original_end = (jpeg_uc*)_stream.Data() + _stream.Size();
             jpeg__result_info ri;
-            uint8_t * data = (uint8_t*)jpeg__jpeg_load(&s, &x, &y, &comp, 3, &ri);
+            int shift = _param.scale == 8 ? 3 : _param.scale == 4 ? 2 : _param.scale == 2 ? 1 : 0;
+            int roi[4] = { (int)Simd::Min<size_t>(_param.left, INT_MAX), (int)Simd::Min<size_t>(_param.top, INT_MAX),
+                (int)Simd::Min<size_t>(_param.right, INT_MAX), (int)Simd::Min<size_t>(_param.bottom, INT_MAX) };
+            uint8_t * data = (uint8_t*)jpeg__jpeg_load(&s, &x, &y, &comp, 3, shift, _param.Region() ? roi : NULL, &ri);
             if (data)
             {
-                size_t stride = 3 * x;
                 _image.Recreate(x, y, (Image::Format)_param.format);
-                switch (_param.format)
-                {
-                case SimdPixelFormatGray8:
-                    Base::RgbToGray(data, x, y, stride, _image.data, _image.stride);
-                    break;
-                case SimdPixelFormatBgr24:
-                    Base::BgrToRgb(data, x, y, stride, _image.data, _image.stride);
-                    break;
-                case SimdPixelFormatBgra32:
-                    Base::RgbToBgra(data, x, y, stride, _image.data, _image.stride, 0xFF);
-                    break;
-                case SimdPixelFormatRgb24:
-                    Base::Copy(data, stride, x, y, 3, _image.data, _image.stride);
-                    break;
-                case SimdPixelFormatRgba32:
-                    Base::BgrToBgra(data, x, y, stride, _image.data, _image.stride, 0xFF);
-                    break;
-                default: 
-                    break;
-                }
+                jpeg__rgb_to_image(data, x, y, 3 * x, _param.format, _image.data, _image.stride);
                 JPEG_FREE(data);
                 return true;
             }
             return false;
         }
+
+        bool ImageJpegLoader::Progress(const uint8_t* data, size_t size)
+        {
+            if (_decoder == NULL)
+                _decoder = new Decoder();
+            Decoder& d = *_decoder;
+            jpeg__context& s = d.s;
+            // received data can be moved to another buffer
+            s.img_buffer = (jpeg_uc*)data + (s.img_buffer - s.img_buffer_original);
+            s.img_buffer_original = (jpeg_uc*)data;
+            s.img_buffer_end = s.img_buffer_original_end = (jpeg_uc*)data + size;
+            if (d.stage == Decoder::StageHeader)
+            {
+                if (d.z == NULL)
+                {
+                    d.z = (jpeg__jpeg*)jpeg__malloc(sizeof(jpeg__jpeg));
+                    if (d.z == NULL)
+                        return false;
+                    memset(d.z, 0, sizeof(jpeg__jpeg));
+                    d.z->s = &s;
+                }
+                jpeg__jpeg* z = d.z;
+                // headers are parsed from the beginning until the first scan is reached
+                jpeg__cleanup_jpeg(z);
+                s.img_buffer = s.img_buffer_original;
+                z->threads = 1;
+                z->deferred = 0;
+                z->scale_shift = 0;
+                z->roi = 0;
+                jpeg__setup_jpeg(z);
+                int result = jpeg__stream_header(z);
+                if (!result || s.img_buffer >= s.img_buffer_end)
+                {
+                    jpeg__cleanup_jpeg(z);
+                    return s.img_buffer >= s.img_buffer_end;
+                }
+                if (z->progressive || z->scan_n != s.img_n)
+                {
+                    // only baseline image with single interleaved scan can be decoded row by row
+                    jpeg__cleanup_jpeg(z);
+                    d.stage = Decoder::StageWhole;
+                }
+                else
+                {
+                    jpeg__jpeg_reset(z);
+                    jpeg__setup_resample(z, 3, d.res_comp, &d.n, &d.decode_n, &d.is_rgb);
+                    _image.Recreate(s.img_x, s.img_y, (Image::Format)_param.format);
+                    d.stage = Decoder::StageScan;
+                }
+            }
+            if (d.stage == Decoder::StageScan)
+            {
+                jpeg__jpeg* z = d.z;
+                while (d.rows < z->img_mcu_y)
+                {
+                    int result = jpeg__stream_mcu_row(z, d.rows);
+                    if (result == 0)
+                        return false;
+                    if (result < 0)
+                        break;
+                    d.rows = result == 2 ? z->img_mcu_y : d.rows + 1;
+                }
+                // fancy upsampling of chroma needs the next MCU row
+                size_t ready = d.rows == z->img_mcu_y ? s.img_y : Simd::Min<size_t>(Simd::Max(d.rows - 1, 0) * z->img_mcu_h, s.img_y);
+                if (ready > _ready)
+                {
+                    size_t width = s.img_x, height = ready - _ready, stride = 3 * width;
+                    d.buffer.Resize((d.decode_n + d.n) * (width + 3) + stride * height);
+                    jpeg_uc* linebuf = d.buffer.data, * rgb = linebuf + (d.decode_n + d.n) * (width + 3);
+                    jpeg__resample_rows(z, d.res_comp, linebuf, linebuf + d.decode_n * (width + 3), d.decode_n, d.n, d.is_rgb,
+                        rgb, 0, (unsigned int)width, (unsigned int)_ready, (unsigned int)ready);
+                    jpeg__rgb_to_image(rgb, width, height, stride, _param.format, _image.data + _ready * _image.stride, _image.stride);
+                    _ready = ready;
+                }
+                if (d.rows == z->img_mcu_y)
+                {
+                    jpeg__cleanup_jpeg(z);
+                    d.stage = Decoder::StageDone;
+                }
+            }
+            if (d.stage == Decoder::StageWhole)
+            {
+                // progressive image is decoded when its end is received
+                if (size >= 2 && data[size - 2] == 0xFF && data[size - 1] == 0xD9)
+                {
+                    _stream = InputMemoryStream(data, size);
+                    if (!FromStream())
+                        return false;
+                    _ready = _image.height;
+                    d.stage = Decoder::StageDone;
+                }
+            }
+            return true;
+        }
+
+        bool ImageJpegLoader::Downscale()
+        {
+            return true;
+        }
+
+        bool ImageJpegLoader::Crop()
+        {
+            return true;
+        }
     }
 }
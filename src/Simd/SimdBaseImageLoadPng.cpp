@@ -147,87 +147,244 @@ namespace Simd
                 }
             }
 
-            static int ParseHuffmanBlock(InputMemoryStream& is, const Zhuffman& zLength, const Zhuffman& zDistance, OutputMemoryStream& os)
+            const int ZTABLE_BITS = 11;
+            const int ZTABLE_SIZE = 1 << ZTABLE_BITS;
+            const int ZTABLE_MASK = ZTABLE_SIZE - 1;
+
+            const int ZLENGTH_BASE[31] = { 3,4,5,6,7,8,9,10,11,13, 15,17,19,23,27,31,35,43,51,59, 67,83,99,115,131,163,195,227,258,0,0 };
+            const int ZLENGTH_EXTRA[31] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0,0,0 };
+            const int ZDIST_BASE[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193, 257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0 };
+            const int ZDIST_EXTRA[32] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+            enum ZentryType
             {
-                static const int zlengthBase[31] = { 3,4,5,6,7,8,9,10,11,13, 15,17,19,23,27,31,35,43,51,59, 67,83,99,115,131,163,195,227,258,0,0 };
-                static const int zlengthExtra[31] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0,0,0 };
-                static const int zdistBase[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193, 257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0 };
-                static const int zdistExtra[32] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+                ZentrySlow = 0,
+                ZentryLiteral,
+                ZentryLiterals,
+                ZentryMatch,
+                ZentryEnd,
+            };
 
-                SIMD_PERF_FUNC();
+            //entry: bits [0..7] - code size, [8..11] - type, [12..15] - extra bits, [16..31] - value.
+            SIMD_INLINE uint32_t Zentry(int size, int type, int extra, int value)
+            {
+                return uint32_t(size) | (uint32_t(type) << 8) | (uint32_t(extra) << 12) | (uint32_t(value) << 16);
+            }
 
-                uint8_t* beg = os.Data(), * dst = os.Current(), * end = beg + os.Capacity();
-                for (;;)
+            static int ZhuffmanPeek(const Zhuffman& z, int bits, int avail, int& size)
+            {
+                int b = z.fast[bits & ZFAST_MASK];
+                if (b)
+                {
+                    size = b >> 9;
+                    return size <= avail ? b & 511 : -1;
+                }
+                int k = BitRev16(bits & 0xFFFF);
+                for (size = ZFAST_BITS + 1; size <= avail && k >= z.maxCode[size]; ++size);
+                if (size > avail || size >= 16)
+                    return -1;
+                b = (k >> (16 - size)) - z.firstCode[size] + z.firstSymbol[size];
+                if (b >= sizeof(z.size) || z.size[b] != size)
+                    return -1;
+                return z.value[b];
+            }
+
+            static SIMD_INLINE uint32_t ZsymbolEntry(int symbol, int size, bool distance)
+            {
+                if (distance)
+                    return symbol < 30 ? Zentry(size, ZentryMatch, ZDIST_EXTRA[symbol], ZDIST_BASE[symbol]) : ZentrySlow;
+                if (symbol < 256)
+                    return Zentry(size, ZentryLiteral, 0, symbol);
+                if (symbol == 256)
+                    return Zentry(size, ZentryEnd, 0, 0);
+                symbol -= 257;
+                return symbol < 29 ? Zentry(size, ZentryMatch, ZLENGTH_EXTRA[symbol], ZLENGTH_BASE[symbol]) : ZentrySlow;
+            }
+
+            struct Ztable
+            {
+                uint32_t entry[ZTABLE_SIZE];
+
+                void Build(const Zhuffman& z, bool distance)
                 {
-                    int z = ZhuffmanDecode(is, zLength);
-                    if (z < 256)
+                    for (int i = 0; i < ZTABLE_SIZE; ++i)
                     {
-                        if (z < 0)
-                            return PngError("bad huffman code", "Corrupt PNG");
-                        if (dst >= end)
+                        int size0, size1;
+                        int symbol0 = ZhuffmanPeek(z, i, ZTABLE_BITS, size0);
+                        if (symbol0 < 0)
                         {
-                            os.Reserve(end - beg + 1);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
+                            entry[i] = ZentrySlow;
+                            continue;
                         }
-                        *dst++ = (uint8_t)z;
+                        entry[i] = ZsymbolEntry(symbol0, size0, distance);
+                        if (distance || symbol0 >= 256)
+                            continue;
+                        int symbol1 = ZhuffmanPeek(z, i >> size0, ZTABLE_BITS - size0, size1);
+                        if (symbol1 >= 0 && symbol1 < 256)
+                            entry[i] = Zentry(size0 + size1, ZentryLiterals, 0, symbol0 | (symbol1 << 8));
+                    }
+                }
+            };
+
+            struct ZbitReader
+            {
+                const uint8_t* ptr, * end;
+                uint64_t buf;
+                int count, over;
+
+                SIMD_INLINE ZbitReader(InputMemoryStream& is)
+                {
+                    ptr = is.Current();
+                    end = is.Data() + is.Size();
+                    buf = is.BitBuffer();
+                    count = (int)is.BitCount();
+                    over = 0;
+                }
+
+                SIMD_INLINE void Refill()
+                {
+                    if (end - ptr >= 8)
+                    {
+                        buf |= *(uint64_t*)ptr << count;
+                        ptr += (63 - count) >> 3;
+                        count |= 56;
                     }
                     else
                     {
-                        int len, dist;
-                        if (z == 256)
+                        for (; count <= 56; count += 8)
                         {
-                            os.Seek(dst - beg);
-                            return 1;
+                            if (ptr < end)
+                                buf |= uint64_t(*ptr++) << count;
+                            else
+                                over += 8;
                         }
-                        z -= 257;
-                        len = zlengthBase[z];
-                        if (zlengthExtra[z])
-                            len += (int)is.ReadBits(zlengthExtra[z]);
-                        z = ZhuffmanDecode(is, zDistance);
-                        if (z < 0)
+                    }
+                }
+
+                SIMD_INLINE uint32_t Bits(int size) const
+                {
+                    return uint32_t(buf) & ((1 << size) - 1);
+                }
+
+                SIMD_INLINE void Skip(int size)
+                {
+                    buf >>= size;
+                    count -= size;
+                }
+
+                SIMD_INLINE bool Return(InputMemoryStream& is)
+                {
+                    int rest = count - over;
+                    if (rest < 0)
+                        return false;
+                    ptr -= rest >> 3;
+                    is.Seek(ptr - is.Data());
+                    is.BitCount() = rest & 7;
+                    is.BitBuffer() = buf & ((1 << (rest & 7)) - 1);
+                    return true;
+                }
+            };
+
+            static SIMD_INLINE uint32_t ZdecodeSlow(const Zhuffman& z, const ZbitReader& br, bool distance)
+            {
+                int size, symbol = ZhuffmanPeek(z, (int)br.Bits(16), 15, size);
+                return symbol < 0 ? ZentrySlow : ZsymbolEntry(symbol, size, distance);
+            }
+
+            static SIMD_INLINE bool Zreserve(OutputMemoryStream& os, uint8_t*& beg, uint8_t*& dst, uint8_t*& end, size_t size)
+            {
+                os.Seek(dst - beg);
+                os.Reserve(dst - beg + size);
+                beg = os.Data();
+                dst = os.Current();
+                end = beg + os.Capacity();
+                return true;
+            }
+
+            static SIMD_INLINE void ZcopyMatch(uint8_t* dst, int dist, int len, bool wide)
+            {
+                const uint8_t* src = dst - dist;
+                if (dist == 1)
+                    memset(dst, *src, len);
+                else if (wide)
+                {
+                    uint8_t* stop = dst + len;
+                    if (dist < 8)
+                    {
+                        // the pattern is repeated until its period is not less than 8 bytes
+                        int period = dist * ((8 + dist - 1) / dist);
+                        for (int i = 0; i < period; ++i)
+                            dst[i] = src[i];
+                        dst += period;
+                        src = dst - period;
+                    }
+                    while (dst < stop)
+                    {
+                        // memcpy through a register keeps the copy correct for overlapped ranges
+                        uint64_t word;
+                        memcpy(&word, src, 8);
+                        memcpy(dst, &word, 8);
+                        dst += 8;
+                        src += 8;
+                    }
+                }
+                else
+                {
+                    for (int i = 0; i < len; ++i)
+                        dst[i] = src[i];
+                }
+            }
+
+            static int ParseHuffmanBlock(InputMemoryStream& is, const Zhuffman& zLength, const Zhuffman& zDistance, OutputMemoryStream& os)
+            {
+                const size_t SLACK = 16;
+
+                SIMD_PERF_FUNC();
+
+                Ztable tLength, tDistance;
+                tLength.Build(zLength, false);
+                tDistance.Build(zDistance, true);
+                ZbitReader br(is);
+                uint8_t* beg = os.Data(), * dst = os.Current(), * end = beg + os.Capacity();
+                for (;;)
+                {
+                    br.Refill();
+                    uint32_t entry = tLength.entry[br.Bits(ZTABLE_BITS)];
+                    if (entry == ZentrySlow && (entry = ZdecodeSlow(zLength, br, false)) == ZentrySlow)
+                        return PngError("bad huffman code", "Corrupt PNG");
+                    br.Skip(entry & 0xFF);
+                    int type = (entry >> 8) & 0xF, value = entry >> 16;
+                    if (type == ZentryLiteral || type == ZentryLiterals)
+                    {
+                        if (end - dst < 2)
+                            Zreserve(os, beg, dst, end, 2);
+                        dst[0] = (uint8_t)value;
+                        dst[1] = (uint8_t)(value >> 8);
+                        dst += type == ZentryLiteral ? 1 : 2;
+                    }
+                    else if (type == ZentryMatch)
+                    {
+                        int len = value + br.Bits((entry >> 12) & 0xF);
+                        br.Skip((entry >> 12) & 0xF);
+                        entry = tDistance.entry[br.Bits(ZTABLE_BITS)];
+                        if (entry == ZentrySlow && (entry = ZdecodeSlow(zDistance, br, true)) == ZentrySlow)
                             return PngError("bad huffman code", "Corrupt PNG");
-                        dist = zdistBase[z];
-                        if (zdistExtra[z])
-                            dist += (int)is.ReadBits(zdistExtra[z]);
+                        br.Skip(entry & 0xFF);
+                        int dist = (entry >> 16) + br.Bits((entry >> 12) & 0xF);
+                        br.Skip((entry >> 12) & 0xF);
                         if (dst - beg < dist)
                             return PngError("bad dist", "Corrupt PNG");
                         if (dst + len > end)
-                        {
-                            os.Reserve(dst - beg + len);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
-                        }
-                        if (dist == 1)
-                        {
-                            uint8_t val = dst[-dist];
-                            if (len < 16)
-                            {
-                                while (len--)
-                                    *dst++ = val;
-                            }
-                            else
-                            {
-                                memset(dst, val, len);
-                                dst += len;
-                            }
-                        }
-                        else
-                        {
-                            uint8_t* src = dst - dist;
-                            if (dist < len || len < 16)
-                            {
-                                while(len--)
-                                    *dst++ = *src++;
-                            }
-                            else
-                            {
-                                memcpy(dst, src, len);
-                                dst += len;
-                            }                        
-                        }
+                            Zreserve(os, beg, dst, end, len);
+                        ZcopyMatch(dst, dist, len, dst + len + SLACK <= end);
+                        dst += len;
+                    }
+                    else
+                    {
+                        os.Seek(dst - beg);
+                        if (!br.Return(is))
+                            return PngError("read past buffer", "Corrupt PNG");
+                        return 1;
                     }
                 }
             }
@@ -316,7 +473,7 @@ namespace Simd
                 return 1;
             }
 
-            bool Decode(InputMemoryStream& is, OutputMemoryStream& os, bool parseHeader)
+            bool Decode(InputMemoryStream& is, OutputMemoryStream& os, bool parseHeader, Adler32Ptr adler32)
             {
                 static const uint8_t ZdefaultLength[288] = {
                    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
@@ -369,6 +526,14 @@ namespace Simd
                             return false;
                     }
                 } while (!final);
+                if (parseHeader && adler32)
+                {
+                    uint8_t check[4];
+                    is.ClearBits();
+                    if (is.Read(4, check) == 4 && adler32(os.Data(), (int)os.Size()) !=
+                        ((uint32_t(check[0]) << 24) | (uint32_t(check[1]) << 16) | (uint32_t(check[2]) << 8) | uint32_t(check[3])))
+                        return PngError("bad adler32", "Corrupt PNG");
+                }
                 return true;
             }
         }
@@ -826,6 +991,7 @@ namespace Simd
             , _toBgra8(NULL)
             , _toAny16(NULL)
             , _toBgra16(NULL)
+            , _adler32(Base::ZlibAdler32)
         {
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgba32;
@@ -858,7 +1024,7 @@ namespace Simd
 
             InputMemoryStream zSrc = MergedDataStream();
             OutputMemoryStream zDst(AlignHi(size_t(_width) * _depth, 8) * _height * _channels + _height);
-            if(!Zlib::Decode(zSrc, zDst, !_iPhone))
+            if(!Zlib::Decode(zSrc, zDst, !_iPhone, _adler32))
                 return false;
 
             int req_comp = 4;
@@ -952,6 +1118,31 @@ namespace Simd
             return false;
         }
 
+        bool ImagePngLoader::Progress(const uint8_t* data, size_t size)
+        {
+            if (_ready)
+                return true;
+            // image is decoded when IEND chunk is received
+            InputMemoryStream stream(data, size);
+            if (!stream.Skip(8))
+                return true;
+            for (uint32_t chunkSize, chunkType; stream.ReadBe32u(chunkSize) && stream.ReadBe32u(chunkType);)
+            {
+                if (!stream.CanRead(size_t(chunkSize) + 4))
+                    break;
+                if (chunkType == ChunkType('I', 'E', 'N', 'D'))
+                {
+                    _stream = InputMemoryStream(data, size);
+                    if (!FromStream())
+                        return false;
+                    _ready = _image.height;
+                    return true;
+                }
+                stream.Skip(size_t(chunkSize) + 4);
+            }
+            return true;
+        }
+
         bool ImagePngLoader::ParseFile()
         {
             _first = true, _iPhone = false, _hasTrans = false;
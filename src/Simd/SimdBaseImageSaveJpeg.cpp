@@ -25,6 +25,7 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdImageSaveJpeg.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -367,6 +368,273 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        static const uint8_t DC_LUM_COD[] = { 0, 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+        static const uint8_t DC_LUM_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        static const uint8_t AC_LUM_COD[] = { 0, 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+        static const uint8_t AC_LUM_VAL[] = {
+           0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 
+           0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 
+           0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 
+           0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 
+           0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 
+           0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 
+           0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+        };
+        static const uint8_t DC_CHR_COD[] = { 0, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+        static const uint8_t DC_CHR_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        static const uint8_t AC_CHR_COD[] = { 0, 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+        static const uint8_t AC_CHR_VAL[] = {
+           0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 
+           0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 
+           0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 
+           0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 
+           0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 
+           0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 
+           0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+        };
+
+        void JpegHuffman::Init(const uint8_t* cod, const uint8_t* val)
+        {
+            count = 0;
+            for (int l = 1; l <= 16; ++l)
+            {
+                bits[l] = cod[l];
+                count += cod[l];
+            }
+            memcpy(vals, val, count);
+            memset(codes, 0, sizeof(codes));
+            for (int l = 1, k = 0, code = 0; l <= 16; ++l, code <<= 1)
+            {
+                for (int i = 0; i < bits[l]; ++i, ++k, ++code)
+                {
+                    codes[vals[k]][0] = uint16_t(code);
+                    codes[vals[k]][1] = uint16_t(l);
+                }
+            }
+        }
+
+        void JpegHuffman::Optimize(const uint32_t* freq)
+        {
+            // Optimal code lengths limited by 16 bits (ITU T.81, Annex K.2).
+            uint32_t f[257];
+            int size[257], next[257], num[33];
+            for (int i = 0; i < 256; ++i)
+                f[i] = freq[i];
+            f[256] = 1;
+            for (int i = 0; i < 257; ++i)
+                size[i] = 0, next[i] = -1;
+            for (;;)
+            {
+                int c1 = -1, c2 = -1;
+                uint32_t v1 = UINT_MAX, v2 = UINT_MAX;
+                for (int i = 0; i < 257; ++i)
+                {
+                    if (f[i] && f[i] <= v1)
+                        v1 = f[i], c1 = i;
+                }
+                for (int i = 0; i < 257; ++i)
+                {
+                    if (f[i] && f[i] <= v2 && i != c1)
+                        v2 = f[i], c2 = i;
+                }
+                if (c2 < 0)
+                    break;
+                f[c1] += f[c2];
+                f[c2] = 0;
+                for (size[c1]++; next[c1] >= 0; size[c1]++)
+                    c1 = next[c1];
+                next[c1] = c2;
+                for (size[c2]++; next[c2] >= 0; size[c2]++)
+                    c2 = next[c2];
+            }
+            memset(num, 0, sizeof(num));
+            for (int i = 0; i < 257; ++i)
+                if (size[i])
+                    num[size[i]]++;
+            for (int i = 32; i > 16; --i)
+            {
+                while (num[i] > 0)
+                {
+                    int j = i - 2;
+                    while (num[j] == 0)
+                        j--;
+                    num[i] -= 2;
+                    num[i - 1]++;
+                    num[j + 1] += 2;
+                    num[j]--;
+                }
+            }
+            int last = 16;
+            while (num[last] == 0)
+                last--;
+            num[last]--;
+            uint8_t cod[17], val[256];
+            cod[0] = 0;
+            for (int l = 1; l <= 16; ++l)
+                cod[l] = uint8_t(num[l]);
+            for (int l = 1, k = 0; l <= 32; ++l)
+                for (int i = 0; i < 256; ++i)
+                    if (size[i] == l)
+                        val[k++] = uint8_t(i);
+            Init(cod, val);
+        }
+
+        void JpegHuffman::Write(OutputMemoryStream& stream, uint8_t id) const
+        {
+            stream.Write8u(id);
+            stream.Write(bits + 1, 16);
+            stream.Write(vals, count);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void WriteFillBits(OutputMemoryStream& stream)
+        {
+            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
+            Base::WriteBits(stream, FILL_BITS);
+        }
+
+        struct JpegHuffmanDecoder
+        {
+            static const int FAST = 11;
+            uint16_t fast[1 << FAST];
+            int maxCode[17], offset[17];
+            const uint8_t* vals;
+
+            JpegHuffmanDecoder(const uint8_t* cod, const uint8_t* val)
+                : vals(val)
+            {
+                memset(fast, 0, sizeof(fast));
+                for (int l = 1, k = 0, code = 0; l <= 16; ++l, code <<= 1)
+                {
+                    offset[l] = k - code;
+                    for (int i = 0; i < cod[l] && l <= FAST; ++i)
+                    {
+                        int first = (code + i) << (FAST - l), last = (code + i + 1) << (FAST - l);
+                        for (int j = first; j < last; ++j)
+                            fast[j] = uint16_t(l << 8 | vals[k + i]);
+                    }
+                    code += cod[l];
+                    k += cod[l];
+                    maxCode[l] = cod[l] ? code - 1 : -1;
+                }
+            }
+        };
+
+        class JpegBitReader
+        {
+            const uint8_t* _data, * _end;
+            uint64_t _buffer;
+            int _count;
+
+            SIMD_INLINE void Fill()
+            {
+                while (_count <= 56)
+                {
+                    uint64_t byte = 0;
+                    if (_data < _end)
+                    {
+                        byte = *_data++;
+                        if (byte == 0xFF)
+                            _data++;
+                    }
+                    _buffer |= byte << (56 - _count);
+                    _count += 8;
+                }
+            }
+
+            SIMD_INLINE void Skip(int n)
+            {
+                _buffer <<= n;
+                _count -= n;
+            }
+
+        public:
+            SIMD_INLINE JpegBitReader(const uint8_t* data, size_t size)
+                : _data(data)
+                , _end(data + size)
+                , _buffer(0)
+                , _count(0)
+            {
+            }
+
+            SIMD_INLINE int Decode(const JpegHuffmanDecoder& decoder)
+            {
+                if (_count < 32)
+                    Fill();
+                int fast = decoder.fast[_buffer >> (64 - JpegHuffmanDecoder::FAST)];
+                if (fast)
+                {
+                    Skip(fast >> 8);
+                    return fast & 0xFF;
+                }
+                int peek = int(_buffer >> 48);
+                for (int l = JpegHuffmanDecoder::FAST + 1; l <= 16; ++l)
+                {
+                    int code = peek >> (16 - l);
+                    if (code <= decoder.maxCode[l])
+                    {
+                        Skip(l);
+                        return decoder.vals[code + decoder.offset[l]];
+                    }
+                }
+                assert(0);
+                return 0;
+            }
+
+            SIMD_INLINE uint16_t Get(int n)
+            {
+                uint16_t value = uint16_t(_buffer >> (64 - n));
+                Skip(n);
+                return value;
+            }
+        };
+
+        static void JpegGatherInterval(const OutputMemoryStream& src, int mcus, int lumas, const JpegHuffmanDecoder* decoders, uint32_t* freq, std::vector<uint32_t>& tokens)
+        {
+            JpegBitReader reader(src.Data(), src.Size());
+            tokens.reserve(src.Size());
+            for (int mcu = 0; mcu < mcus; ++mcu)
+            {
+                for (int block = 0, blocks = lumas + 2; block < blocks; ++block)
+                {
+                    int t = block < lumas ? 0 : 2;
+                    for (int k = 0; k < 64; t |= 1)
+                    {
+                        int symbol = reader.Decode(decoders[t]);
+                        int run = k ? symbol >> 4 : 0, size = k ? symbol & 15 : symbol;
+                        freq[t * 256 + symbol]++;
+                        tokens.push_back(uint32_t(t << 28 | size << 24 | symbol << 16 | (size ? reader.Get(size) : 0)));
+                        if (k && size == 0 && run != 15)
+                            break;
+                        k += run + 1;
+                    }
+                }
+            }
+        }
+
+        static void JpegWriteInterval(const std::vector<uint32_t>& tokens, const JpegHuffman* huffman, OutputMemoryStream& dst)
+        {
+            BitBuf bitBuf;
+            for (size_t i = 0; i < tokens.size(); ++i)
+            {
+                uint32_t token = tokens[i];
+                bitBuf.Push(huffman[token >> 28].codes[(token >> 16) & 0xFF]);
+                uint16_t bits[2] = { uint16_t(token), uint16_t((token >> 24) & 0xF) };
+                if (bits[1])
+                    bitBuf.Push(bits);
+                if (bitBuf.Full())
+                {
+                    WriteBits(dst, bitBuf.data, bitBuf.size);
+                    bitBuf.Clear();
+                }
+            }
+            WriteBits(dst, bitBuf.data, bitBuf.size);
+            WriteFillBits(dst);
+        }
+
+        //---------------------------------------------------------------------
+
         ImageJpegSaver::ImageJpegSaver(const ImageSaverParam& param)
             : ImageSaver(param)
             , _deintBgra(NULL)
@@ -417,6 +685,7 @@ namespace Simd
                 0.785694958f * 2.828427125f, 0.541196100f * 2.828427125f, 0.275899379f * 2.828427125f };
             _quality = _param.quality;
             _quality = _quality ? _quality : 90;
+            _optimize = _param.file == SimdImageFileJpegOptimized;
             _subSample = (_quality <= 90 || _param.yuvType != SimdYuvUnknown) ? 1 : 0;
             _quality = _quality < 1 ? 1 : _quality > 100 ? 100 : _quality;
             _quality = _quality < 50 ? 5000 / _quality : 200 - _quality * 2;
@@ -438,134 +707,182 @@ namespace Simd
             }
             _block = _subSample ? 16 : 8;
             _width = (int)AlignHi(_param.width, _block);
+            _rows = (int)DivHi(_param.height, _block);
+            _restart = Base::GetThreadNumber() > 1 && _rows > 1 ? _width / _block : 0;
             if (_param.format != SimdPixelFormatGray8 && _param.yuvType == SimdYuvUnknown)
-                _buffer.Resize(_width * _block * 3);
+                _buffer.Resize(_width * _block * 3 * (_restart ? Base::GetThreadNumber() : 1));
         }
 
-        void ImageJpegSaver::WriteHeader()
+        void ImageJpegSaver::WriteHeader(const JpegHuffman* huffman)
         {
-            static const uint8_t DC_LUM_COD[] = { 0, 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
-            static const uint8_t DC_LUM_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
-            static const uint8_t AC_LUM_COD[] = { 0, 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
-            static const uint8_t AC_LUM_VAL[] = {
-               0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 
-               0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 
-               0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 
-               0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 
-               0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 
-               0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 
-               0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
-            };
-            static const uint8_t DC_CHR_COD[] = { 0, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
-            static const uint8_t DC_CHR_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
-            static const uint8_t AC_CHR_COD[] = { 0, 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
-            static const uint8_t AC_CHR_VAL[] = {
-               0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 
-               0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 
-               0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 
-               0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 
-               0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 
-               0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 
-               0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
-            };
             static const uint8_t head0[] = { 0xFF, 0xD8, 0xFF, 0xE0, 0, 0x10, 'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0xFF, 0xDB, 0, 0x84, 0 };
             static const uint8_t head2[] = { 0xFF, 0xDA, 0, 0xC, 3, 1, 0, 2, 0x11, 3, 0x11, 0, 0x3F, 0 };
+            const uint8_t dri[] = { 0xFF, 0xDD, 0, 4, uint8_t(_restart >> 8), uint8_t(_restart) };
+            const int dht = 2 + 4 * 17 + huffman[0].count + huffman[1].count + huffman[2].count + huffman[3].count;
             const uint8_t head1[] = { 0xFF, 0xC0, 0, 0x11, 8,  uint8_t(_param.height >> 8),  uint8_t(_param.height),  uint8_t(_param.width >> 8),  
-                uint8_t(_param.width), 3, 1, uint8_t(_subSample ? 0x22 : 0x11), 0, 2, 0x11, 1, 3, 0x11, 1, 0xFF, 0xC4, 0x01, 0xA2, 0 };
+                uint8_t(_param.width), 3, 1, uint8_t(_subSample ? 0x22 : 0x11), 0, 2, 0x11, 1, 3, 0x11, 1, 0xFF, 0xC4, uint8_t(dht >> 8), uint8_t(dht) };
             _stream.Write(head0, sizeof(head0));
             _stream.Write(_uY, 64);
             _stream.Write8u(1);
             _stream.Write(_uUv, 64);
             _stream.Write(head1, sizeof(head1));
-            _stream.Write(DC_LUM_COD + 1, sizeof(DC_LUM_COD) - 1);
-            _stream.Write(DC_LUM_VAL, sizeof(DC_LUM_VAL));
-            _stream.Write8u(0x10); // HTYACinfo
-            _stream.Write(AC_LUM_COD + 1, sizeof(AC_LUM_COD) - 1);
-            _stream.Write(AC_LUM_VAL, sizeof(AC_LUM_VAL));
-            _stream.Write8u(1); // HTUDCinfo
-            _stream.Write(DC_CHR_COD + 1, sizeof(DC_CHR_COD) - 1);
-            _stream.Write(DC_CHR_VAL, sizeof(DC_CHR_VAL));
-            _stream.Write8u(0x11); // HTUACinfo
-            _stream.Write(AC_CHR_COD + 1, sizeof(AC_CHR_COD) - 1);
-            _stream.Write(AC_CHR_VAL, sizeof(AC_CHR_VAL));
+            huffman[0].Write(_stream, 0x00); // HTYDCinfo
+            huffman[1].Write(_stream, 0x10); // HTYACinfo
+            huffman[2].Write(_stream, 0x01); // HTUDCinfo
+            huffman[3].Write(_stream, 0x11); // HTUACinfo
+            if (_restart)
+                _stream.Write(dri, sizeof(dri));
             _stream.Write(head2, sizeof(head2));
         }
 
-        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        static void WriteIntervals(OutputMemoryStream& stream, const std::vector<OutputMemoryStream>& intervals)
         {
-            Init();
-            WriteHeader();
-            uint8_t* r = _buffer.data, * g = r + _width * _block,* b = g + _width * _block;
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            for (size_t i = 0; i < intervals.size(); ++i)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                switch (_param.format)
+                if (i)
                 {
-                case SimdPixelFormatBgr24:
-                    _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
-                    break;
-                case SimdPixelFormatBgra32:
-                    _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
-                    break;
-                case SimdPixelFormatRgb24:
-                    _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
-                    break;
-                case SimdPixelFormatRgba32:
-                    _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
-                    break;
-                default: 
-                    break;
+                    stream.Write8u(0xFF);
+                    stream.Write8u(uint8_t(0xD0 + (i - 1) % 8));
                 }
-                if(_param.format == SimdPixelFormatGray8)
-                    _writeBlock(_stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
-                else
-                    _writeBlock(_stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
-                src += block * stride;
+                stream.Write(intervals[i].Data(), intervals[i].Size());
+            }
+        }
+
+        void ImageJpegSaver::WriteData(const std::vector<OutputMemoryStream>& intervals)
+        {
+            JpegHuffman huffman[4];
+            huffman[0].Init(DC_LUM_COD, DC_LUM_VAL);
+            huffman[1].Init(AC_LUM_COD, AC_LUM_VAL);
+            huffman[2].Init(DC_CHR_COD, DC_CHR_VAL);
+            huffman[3].Init(AC_CHR_COD, AC_CHR_VAL);
+            if (_optimize)
+            {
+                const JpegHuffmanDecoder decoders[4] = { JpegHuffmanDecoder(DC_LUM_COD, DC_LUM_VAL), JpegHuffmanDecoder(AC_LUM_COD, AC_LUM_VAL),
+                    JpegHuffmanDecoder(DC_CHR_COD, DC_CHR_VAL), JpegHuffmanDecoder(AC_CHR_COD, AC_CHR_VAL) };
+                int mcus = _restart ? _restart : _rows * _width / _block, lumas = _subSample ? 4 : 1;
+                size_t threads = Base::GetThreadNumber();
+                std::vector<uint32_t> freq(threads * 4 * 256, 0);
+                std::vector<std::vector<uint32_t>> tokens(intervals.size());
+                Parallel(0, intervals.size(), [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        JpegGatherInterval(intervals[i], mcus, lumas, decoders, freq.data() + thread * 4 * 256, tokens[i]);
+                }, threads);
+                for (size_t t = 1; t < threads; ++t)
+                    for (size_t i = 0; i < 4 * 256; ++i)
+                        freq[i] += freq[t * 4 * 256 + i];
+                for (size_t t = 0; t < 4; ++t)
+                    huffman[t].Optimize(freq.data() + t * 256);
+                std::vector<OutputMemoryStream> optimized(intervals.size());
+                Parallel(0, intervals.size(), [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        JpegWriteInterval(tokens[i], huffman, optimized[i]);
+                }, threads);
+                WriteHeader(huffman);
+                WriteIntervals(_stream, optimized);
+            }
+            else
+            {
+                WriteHeader(huffman);
+                WriteIntervals(_stream, intervals);
             }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
             _stream.Write8u(0xFF);
             _stream.Write8u(0xD9);
+        }
+
+        void ImageJpegSaver::WriteRow(OutputMemoryStream& stream, const uint8_t* src, size_t stride, int block, uint8_t* buf, int dc[3])
+        {
+            uint8_t* r = buf, * g = r + _width * _block, * b = g + _width * _block;
+            switch (_param.format)
+            {
+            case SimdPixelFormatBgr24:
+                _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
+                break;
+            case SimdPixelFormatBgra32:
+                _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
+                break;
+            case SimdPixelFormatRgb24:
+                _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
+                break;
+            case SimdPixelFormatRgba32:
+                _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
+                break;
+            default:
+                break;
+            }
+            if (_param.format == SimdPixelFormatGray8)
+                _writeBlock(stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
+            else
+                _writeBlock(stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
+        }
+
+        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            Init();
+            std::vector<OutputMemoryStream> intervals(_restart ? _rows : 1);
+            int step = _restart ? _block : (int)_param.height;
+            Parallel(0, intervals.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                uint8_t* buf = _buffer.data + thread * _width * _block * 3;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    int dc[3] = { 0, 0, 0 };
+                    for (int row = int(i) * step, last = Simd::Min(row + step, (int)_param.height); row < last; row += _block)
+                    {
+                        int block = Simd::Min(row + _block, last) - row;
+                        WriteRow(intervals[i], src + row * stride, stride, block, buf, dc);
+                    }
+                    WriteFillBits(intervals[i]);
+                }
+            }, Base::GetThreadNumber());
+            WriteData(intervals);
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride)
         {
             Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
-            {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeNv12Block(_stream, (int)_param.width, block, y, (int)yStride, uv, (int)uvStride, _fY, _fUv, dc);
-                y += block * yStride;
-                uv += (block / 2) * uvStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+            std::vector<OutputMemoryStream> intervals(_restart ? _rows : 1);
+            int step = _restart ? _block : (int)_param.height;
+            Parallel(0, intervals.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    int dc[3] = { 0, 0, 0 };
+                    for (int row = int(i) * step, last = Simd::Min(row + step, (int)_param.height); row < last; row += _block)
+                    {
+                        int block = Simd::Min(row + _block, last) - row;
+                        _writeNv12Block(intervals[i], (int)_param.width, block, y + row * yStride, (int)yStride,
+                            uv + (row / 2) * uvStride, (int)uvStride, _fY, _fUv, dc);
+                    }
+                    WriteFillBits(intervals[i]);
+                }
+            }, Base::GetThreadNumber());
+            WriteData(intervals);
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride)
         {
             Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
-            {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeYuv420pBlock(_stream, (int)_param.width, block, y, (int)yStride, u, (int)uStride, v, (int)vStride, _fY, _fUv, dc);
-                y += block * yStride;
-                u += (block / 2) * uStride;
-                v += (block / 2) * vStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+            std::vector<OutputMemoryStream> intervals(_restart ? _rows : 1);
+            int step = _restart ? _block : (int)_param.height;
+            Parallel(0, intervals.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    int dc[3] = { 0, 0, 0 };
+                    for (int row = int(i) * step, last = Simd::Min(row + step, (int)_param.height); row < last; row += _block)
+                    {
+                        int block = Simd::Min(row + _block, last) - row;
+                        _writeYuv420pBlock(intervals[i], (int)_param.width, block, y + row * yStride, (int)yStride,
+                            u + (row / 2) * uStride, (int)uStride, v + (row / 2) * vStride, (int)vStride, _fY, _fUv, dc);
+                    }
+                    WriteFillBits(intervals[i]);
+                }
+            }, Base::GetThreadNumber());
+            WriteData(intervals);
             return true;
         }
 
@@ -26,6 +26,9 @@
 #include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
 
 namespace Simd
 {
@@ -58,23 +61,34 @@ namespace Simd
 
         uint32_t ZlibAdler32(uint8_t* data, int size)
         {
+            const int BLOCK = 16, NMAX = 5552 / BLOCK * BLOCK;
             uint32_t lo = 1, hi = 0;
-            for (int b = 0, n = (int)(size % 5552); b < size;)
+            int i = 0, sizeA = size & (~(BLOCK - 1));
+            while (i < sizeA)
             {
-                for (int i = 0; i < n; ++i)
+                for (int end = Min(sizeA, i + NMAX); i < end; i += BLOCK)
                 {
-                    lo += data[b + i];
-                    hi += lo;
+                    uint32_t s = 0, w = 0;
+                    for (int k = 0; k < BLOCK; ++k)
+                    {
+                        s += data[i + k];
+                        w += data[i + k] * (BLOCK - k);
+                    }
+                    hi += lo * BLOCK + w;
+                    lo += s;
                 }
                 lo %= 65521;
                 hi %= 65521;
-                b += n;
-                n = 5552;
             }
-            return (hi << 16) | lo;
+            for (; i < size; ++i)
+            {
+                lo += data[i];
+                hi += lo;
+            }
+            return ((hi % 65521) << 16) | (lo % 65521);
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -83,12 +97,23 @@ namespace Simd
             Array32i hashTable(ZHASH * basket);
             memset(hashTable.data, -1, hashTable.RawSize());
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            int i = Max(begin - 32768, 0), j;
+            for (; i < begin; ++i)
+            {
+                int* hList = hashTable.data + (ZlibHash(data + i) & (ZHASH - 1)) * basket;
+                for (j = 0; j < basket && hList[j] != -1; ++j);
+                if (j == basket)
+                {
+                    memcpy(hList, hList + quality, quality * sizeof(int));
+                    memset(hList + quality, -1, quality * sizeof(int));
+                    j = quality;
+                }
+                hList[j] = i;
+            }
+
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
 
-            int i = 0, j;
             while (i < size - 3)
             {
                 int h = ZlibHash(data + i) & (ZHASH - 1), best = 3;
@@ -155,7 +180,16 @@ namespace Simd
             for (; i < size; ++i)
                 ZlibHuffB(data[i], stream);
             ZlibHuff(256, stream);
+            if (!last)
+                ZlibSyncFlush(stream);
             stream.FlushBits();
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            ZlibDeflate(data, 0, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -313,6 +347,8 @@ namespace Simd
             _encode[5] = Base::EncodeLine5;
             _encode[6] = Base::EncodeLine6;
             _compress = Base::ZlibCompress;
+            _deflate = Base::ZlibDeflate;
+            _adler32 = Base::ZlibAdler32;
         }
 
         bool ImagePngSaver::ToStream(const uint8_t* src, size_t stride)
@@ -341,11 +377,40 @@ namespace Simd
                 memcpy(_filt.data + row * (_size + 1) + 1, _line.data + _size * bestFilter, _size);
             }
             OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
-            _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib);
+            if (_param.quality < 100 && _filt.size > BLOCK)
+                CompressBlocks(zlib);
+            else
+                _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib);
             WriteToStream(zlib.Data(), zlib.Size());
             return true;
         }
 
+        void ImagePngSaver::CompressBlocks(OutputMemoryStream& zlib)
+        {
+            size_t blocks = DivHi(_filt.size, BLOCK);
+            std::vector<OutputMemoryStream> streams(blocks);
+            std::vector<uint32_t> adlers(blocks);
+            Parallel(0, blocks, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                {
+                    size_t beg = b * BLOCK, size = Simd::Min(beg + BLOCK, _filt.size);
+                    streams[b].Reserve((size - beg) / 2);
+                    _deflate(_filt.data, (int)beg, (int)size, COMPRESSION, size == _filt.size, streams[b]);
+                    adlers[b] = _adler32(_filt.data + beg, int(size - beg));
+                }
+            }, Base::GetThreadNumber());
+            zlib.Write(uint8_t(0x78));
+            zlib.Write(uint8_t(0x5e));
+            uint32_t adler = 1;
+            for (size_t b = 0; b < blocks; ++b)
+            {
+                zlib.Write(streams[b].Data(), streams[b].Size());
+                adler = ZlibAdler32Combine(adler, adlers[b], Simd::Min(BLOCK, _filt.size - b * BLOCK));
+            }
+            zlib.WriteBe32u(adler);
+        }
+
         SIMD_INLINE void WriteCrc32(OutputMemoryStream& stream, size_t size)
         {
             stream.WriteBe32u(Base::Crc32(stream.Current() - size - 4, size + 4));
@@ -26,6 +26,11 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <mutex>
+#include <map>
+#include <fstream>
 
 namespace Simd
 {
@@ -40,6 +45,20 @@ namespace Simd
     }
 #endif
 
+    void SynetConvolution32f::ForwardBatch(const float * src, size_t batch, float * buf, float * dst)
+    {
+        const ConvParam32f & p = _param;
+        assert(batch % p.batch == 0);
+        size_t sizeS = p.batch * p.srcC * p.srcH * p.srcW, sizeD = p.batch * p.dstC * p.dstH * p.dstW;
+        buf = Buffer(buf);
+        for (size_t b = 0; b < batch; b += p.batch)
+        {
+            Forward(src, buf, dst);
+            src += sizeS;
+            dst += sizeD;
+        }
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -300,6 +319,14 @@ namespace Simd
                 assert(0);
         }
 
+        size_t SynetConvolution32fThreadNumber(const ConvParam32f & p)
+        {
+            size_t macs = p.dstH * p.dstW * p.dstC * p.kernelY * p.kernelX * p.srcC / p.group;
+            return macs < 1024 * 1024 ? 1 : Base::GetThreadNumber();
+        }
+
+        //---------------------------------------------------------------------
+
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : SynetConvolution32f(p)
         {
@@ -796,7 +823,7 @@ namespace Simd
         
         size_t SynetConvolution32fWinograd::ExternalBufferSize() const
         {
-            return (_strideS + _strideD)*_count*_merge;
+            return (_strideS + _strideD)*_count*_merge*_threads;
         }
 
         size_t SynetConvolution32fWinograd::InternalBufferSize() const
@@ -828,7 +855,7 @@ namespace Simd
         {
             const ConvParam32f & p = _param;
             float * bufS = Buffer(buf);
-            float * bufD = bufS + _strideS * _count * _merge;
+            float * bufD = bufS + _strideS * _count * _merge * _threads;
             if (p.trans)
             {
                 if (_split > 1)
@@ -936,6 +963,17 @@ namespace Simd
                     }
                 }
             }
+            _threads = 1;
+            if (p.trans && _merge == 1)
+            {
+                _threads = Simd::Min(SynetConvolution32fThreadNumber(p), _tileH);
+                if (_split < _threads)
+                {
+                    _tileHs = DivHi(_tileH, _threads);
+                    _split = DivHi(_tileH, _tileHs);
+                }
+                _threads = Simd::Min(_threads, _split);
+            }
             _strideS = p.srcC * _tileHs * _tileW;
             _strideD = p.dstC * _tileHs * _tileW;
         }
@@ -971,39 +1009,48 @@ namespace Simd
 
         void SynetConvolution32fWinograd::ForwardSplitted(const float* src, float* bufS, float* bufD, float* dst)
         {
-            const ConvParam32f& p = _param;
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber());
+            if (_nhwcWeight.data ? (_gemmCb.Size() && _gemmCb.Selected() == NULL) : _gemm.Selected() == NULL)
+                threads = 1;
             for (size_t b = 0; b < _batch; ++b)
             {
-                for (size_t s = 0; s < _split; ++s)
+                Simd::Parallel(0, _split, [&](size_t thread, size_t begin, size_t end)
                 {
-                    size_t padY = s ? 0 : p.padY;
-                    size_t padH = s == _split - 1 ? p.padH : 0;
-                    size_t srcY = s * _tileHs * _blockY + padY - p.padY;
-                    size_t srcH = Simd::Min(_tileHs * _blockY + p.kernelY - 1 - padY - padH, p.srcH - srcY);
-                    size_t M = _tileW * Simd::Min(_tileHs, _tileH - s * _tileHs);
-                    size_t dstY = s * _tileHs * _blockY;
-                    size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
-                    _setInput(src + srcY * p.srcC * p.srcW, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS, _strideS, p.trans);
-                    for (size_t i = 0; i < _count; ++i)
-                    {
-                        if (_nhwcWeight.data)
-                        {
-                            if (_gemmCb.Size())
-                                _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
-                            else
-                                _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
-                        }
-                        else
-                            _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
-                    }
-                    _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
-                }
+                    for (size_t s = begin; s < end; ++s)
+                        ForwardSplitted(src, s, bufS + thread * _strideS * _count, bufD + thread * _strideD * _count, dst);
+                }, threads);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
+        void SynetConvolution32fWinograd::ForwardSplitted(const float* src, size_t s, float* bufS, float* bufD, float* dst)
+        {
+            const ConvParam32f& p = _param;
+            size_t padY = s ? 0 : p.padY;
+            size_t padH = s == _split - 1 ? p.padH : 0;
+            size_t srcY = s * _tileHs * _blockY + padY - p.padY;
+            size_t srcH = Simd::Min(_tileHs * _blockY + p.kernelY - 1 - padY - padH, p.srcH - srcY);
+            size_t M = _tileW * Simd::Min(_tileHs, _tileH - s * _tileHs);
+            size_t dstY = s * _tileHs * _blockY;
+            size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
+            _setInput(src + srcY * p.srcC * p.srcW, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS, _strideS, p.trans);
+            for (size_t i = 0; i < _count; ++i)
+            {
+                if (_nhwcWeight.data)
+                {
+                    if (_gemmCb.Size())
+                        _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
+                    else
+                        _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                }
+                else
+                    _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
+            }
+            _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
+            _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
+        }
+
         //---------------------------------------------------------------------
 
         SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
@@ -1260,14 +1307,41 @@ namespace Simd
 
         void SynetConvolution32fDirectNhwc::Forward(const float * src, float * buf, float * dst)
         {
+            const ConvParam32f & p = _param;
+            size_t bands = Simd::Min(SynetConvolution32fThreadNumber(p), p.dstH / Simd::Max(p.kernelY, p.padY + p.padH + 1));
             for (size_t b = 0; b < _batch; ++b)
             {
-                _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
+                if (bands > 1)
+                {
+                    Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        for (size_t band = begin; band < end; ++band)
+                            ForwardRows(src, p.dstH * band / bands, p.dstH * (band + 1) / bands, dst);
+                    }, bands);
+                }
+                else
+                    _convolutionBiasActivation(src, p, _weight, _bias, _params, dst);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
+        void SynetConvolution32fDirectNhwc::ForwardRows(const float * src, size_t yBeg, size_t yEnd, float * dst)
+        {
+            const ConvParam32f & p = _param;
+            ptrdiff_t sBeg = yBeg * p.strideY - p.padY;
+            ptrdiff_t sEnd = (yEnd - 1) * p.strideY - p.padY + (p.kernelY - 1) * p.dilationY + 1;
+            ConvParam32f band = p;
+            band.batch = 1;
+            band.padY = sBeg < 0 ? -sBeg : 0;
+            band.padH = sEnd > (ptrdiff_t)p.srcH ? sEnd - p.srcH : 0;
+            band.srcH = Simd::Min<ptrdiff_t>(sEnd, p.srcH) - Simd::Max<ptrdiff_t>(sBeg, 0);
+            band.dstH = yEnd - yBeg;
+            src += Simd::Max<ptrdiff_t>(sBeg, 0) * p.srcW * p.srcC;
+            dst += yBeg * p.dstW * p.dstC;
+            _convolutionBiasActivation(src, band, _weight, _bias, _params, dst);
+        }
+
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
         {
             if (p.trans == 0)
@@ -1505,26 +1579,49 @@ namespace Simd
 
         void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
         {
-            for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
+            size_t threads = SynetConvolution32fThreadNumber(p);
+            if (p.dstH >= threads || p.dstC < threads * a.microD)
+            {
+                Simd::Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Forward(src, p, a, 0, p.dstC, begin, end, weight, bias, params, dst);
+                }, threads);
+            }
+            else
             {
-                size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
+                Simd::Parallel(0, p.dstC, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Forward(src, p, a, begin, end, 0, p.dstH, weight, bias, params, dst);
+                }, threads, a.microD);
+            }
+        }
+
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dcBeg, size_t dcEnd, size_t yBeg, size_t yEnd,
+            const float* weight, const float* bias, const float* params, float* dst)
+        {
+            weight += dcBeg * p.kernelY * p.kernelX * p.srcC;
+            if (p.activation == ::SimdConvolutionActivationPrelu)
+                params += dcBeg;
+            for (size_t dc = dcBeg; dc < dcEnd; dc += a.macroD)
+            {
+                size_t macroD = Simd::Min(dcEnd, dc + a.macroD) - dc;
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yb = yBeg; yb < yEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        size_t ye = Simd::Min(yb + a.macroH, yEnd);
                         if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            a.convolutions[TermLast](src + sc, p, a, macroD, yb, ye, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
                         else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
-                        yBeg = yEnd;
+                            a.convolutions[TermInterim](src + sc, p, a, macroD, yb, ye, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                        yb = ye;
                     }
                     weight += a.F * macroC;
                 }
                 if (p.activation == ::SimdConvolutionActivationPrelu)
                     params += macroD;
-                weight += p.kernelY * p.kernelY * p.srcC * macroD - p.srcC * a.F;
+                weight += p.kernelY * p.kernelX * p.srcC * macroD - p.srcC * a.F;
             }
         }
 
@@ -1642,6 +1739,182 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        struct SynetConvolution32fAutotuneCache
+        {
+            std::mutex mutex;
+            bool enable;
+            String path;
+            std::map<String, String> records;
+
+            SynetConvolution32fAutotuneCache()
+                : enable(false)
+            {
+            }
+        };
+
+        static SynetConvolution32fAutotuneCache & AutotuneCache()
+        {
+            static SynetConvolution32fAutotuneCache cache;
+            return cache;
+        }
+
+        void SynetConvolution32fSetAutotune(SimdBool enable, const char * cache)
+        {
+            SynetConvolution32fAutotuneCache & c = AutotuneCache();
+            std::lock_guard<std::mutex> lock(c.mutex);
+            c.enable = enable == SimdTrue;
+            String path = cache ? cache : "";
+            if (path != c.path)
+            {
+                c.path = path;
+                c.records.clear();
+                std::ifstream ifs(path.c_str());
+                for (String line; std::getline(ifs, line);)
+                {
+                    size_t tab = line.find('\t');
+                    if (tab != String::npos)
+                        c.records[line.substr(0, tab)] = line.substr(tab + 1);
+                }
+            }
+        }
+
+        bool SynetConvolution32fAutotuneEnable()
+        {
+            SynetConvolution32fAutotuneCache & c = AutotuneCache();
+            std::lock_guard<std::mutex> lock(c.mutex);
+            return c.enable;
+        }
+
+        String SynetConvolution32fAutotuneKey(const ConvParam32f & p)
+        {
+            static const String model = CpuModel();
+            std::stringstream ss;
+            ss << model << " : " << GetThreadNumber() << " : " << p.Info();
+            ss << "-" << p.dilationY << "x" << p.dilationX << "-" << p.strideY << "x" << p.strideX;
+            ss << "-" << p.padY << "x" << p.padX << "x" << p.padH << "x" << p.padW;
+            ss << "-" << (int)p.activation << "-" << (int)p.compatibility;
+            return ss.str();
+        }
+
+        bool SynetConvolution32fAutotuneLoad(const String & key, String & desc)
+        {
+            SynetConvolution32fAutotuneCache & c = AutotuneCache();
+            std::lock_guard<std::mutex> lock(c.mutex);
+            std::map<String, String>::const_iterator it = c.records.find(key);
+            if (it == c.records.end())
+                return false;
+            desc = it->second;
+            return true;
+        }
+
+        void SynetConvolution32fAutotuneSave(const String & key, const String & desc)
+        {
+            SynetConvolution32fAutotuneCache & c = AutotuneCache();
+            std::lock_guard<std::mutex> lock(c.mutex);
+            c.records[key] = desc;
+            if (c.path.size())
+            {
+                std::ofstream ofs(c.path.c_str(), std::ios::app);
+                ofs << key << '\t' << desc << std::endl;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution32fAutotune::SynetConvolution32fAutotune(const ConvParam32f & p, const SynetConvolution32fPtrs & engines, const String & key)
+            : SynetConvolution32f(p)
+            , _engines(engines)
+            , _key(key)
+        {
+            std::vector<Func> funcs;
+            for (size_t i = 0; i < _engines.size(); ++i)
+                funcs.push_back(Func(_engines[i]));
+            _runtime.Init(funcs);
+        }
+
+        SynetConvolution32fAutotune::~SynetConvolution32fAutotune()
+        {
+            for (size_t i = 0; i < _engines.size(); ++i)
+                delete _engines[i];
+        }
+
+        String SynetConvolution32fAutotune::Desc() const
+        {
+            if (_engines.size() == 1)
+                return _engines[0]->Desc();
+            return Ext() + "::Autotune-" + ToStr(_engines.size());
+        }
+
+        size_t SynetConvolution32fAutotune::ExternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _engines.size(); ++i)
+                size = Simd::Max(size, _engines[i]->ExternalBufferSize());
+            return size;
+        }
+
+        size_t SynetConvolution32fAutotune::InternalBufferSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _engines.size(); ++i)
+                size += _engines[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution32fAutotune::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            bool all = true;
+            for (size_t i = 0; i < _engines.size(); ++i)
+            {
+                SimdBool engine = SimdFalse;
+                _engines[i]->SetParams(weight, &engine, bias, params);
+                all = all && engine == SimdTrue;
+            }
+            if (internal)
+                *internal = all ? SimdTrue : SimdFalse;
+        }
+
+        void SynetConvolution32fAutotune::Forward(const float * src, float * buf, float * dst)
+        {
+            _runtime.Run(Args(src, buf, dst));
+            if (_engines.size() > 1 && _runtime.Selected())
+            {
+                SynetConvolution32f * best = _runtime.Selected()->Engine();
+                SynetConvolution32fAutotuneSave(_key, best->Desc());
+                for (size_t i = 0; i < _engines.size(); ++i)
+                    if (_engines[i] != best)
+                        delete _engines[i];
+                _engines.assign(1, best);
+                _runtime.Init(Func(best));
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution32fSelector::Result()
+        {
+            if (_engines.size() == 1)
+                return _engines[0];
+            String key = SynetConvolution32fAutotuneKey(_param), desc;
+            if (SynetConvolution32fAutotuneLoad(key, desc))
+            {
+                for (size_t i = 0; i < _engines.size(); ++i)
+                {
+                    if (_engines[i]->Desc() == desc)
+                    {
+                        SynetConvolution32f * engine = _engines[i];
+                        for (size_t j = 0; j < _engines.size(); ++j)
+                            if (j != i)
+                                delete _engines[j];
+                        return engine;
+                    }
+                }
+            }
+            return new SynetConvolution32fAutotune(_param, _engines, key);
+        }
+
+        //---------------------------------------------------------------------
+
 //#define SIMD_BASE_ONLY_GEMM_NN
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
@@ -1653,22 +1926,19 @@ namespace Simd
             {
                 return new SynetConvolution32fBf16Gemm(param);
             }
+            else
+            {
+                SynetConvolution32fSelector selector(param);
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
+                selector.Add<SynetConvolution32fDepthwiseDotProduct>()
+                    .Add<SynetConvolution32fWinograd>()
+                    .Add<SynetConvolution32fGemmNT>()
+                    .Add<SynetConvolution32fDirectNchw>()
+                    .Add<SynetConvolution32fNhwcDirect>()
+                    .Add<SynetConvolution32fDirectNhwc>();
 #endif
-            else
-                return new SynetConvolution32fGemmNN(param);
+                return selector.Last<SynetConvolution32fGemmNN>();
+            }
         }
     }
 #endif
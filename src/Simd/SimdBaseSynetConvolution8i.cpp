@@ -241,6 +241,7 @@ namespace Simd
     {
         if (buf == NULL)
         {
+            assert(ExternalBufferSize() == 0 || !Base::SynetGetStrictBuffer());
             _buffer.Resize(ExternalBufferSize());
             buf = _buffer.data;
         }
@@ -434,12 +434,92 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SynetDeconvolution32fBf16Gemm::SynetDeconvolution32fBf16Gemm(const DeconvParam32f& p, ConvolutionInitPtr init, BiasAndActivation biasAndActivation)
+            : SynetDeconvolution32fGemmNN(p)
+        {
+            SimdConvolutionParameters conv;
+            conv.srcC = _K;
+            conv.srcH = p.srcH;
+            conv.srcW = p.srcW;
+            conv.srcT = SimdTensorData32f;
+            conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = _N;
+            conv.dstH = p.srcH;
+            conv.dstW = p.srcW;
+            conv.dstT = SimdTensorData32f;
+            conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.group = 1;
+            conv.activation = SimdConvolutionActivationIdentity;
+            _convolution = (Simd::SynetConvolution32f*)init(_merge, &conv, p.compatibility);
+            _biasAndActivation = biasAndActivation;
+        }
+
+        SynetDeconvolution32fBf16Gemm::~SynetDeconvolution32fBf16Gemm()
+        {
+            delete _convolution;
+        }
+
+        size_t SynetDeconvolution32fBf16Gemm::ExternalBufferSize() const
+        {
+            return (_is1x1 ? 0 : _sizeB * _merge) + _convolution->ExternalBufferSize();
+        }
+
+        size_t SynetDeconvolution32fBf16Gemm::InternalBufferSize() const
+        {
+            return _buffer.size + _convolution->InternalBufferSize();
+        }
+
+        void SynetDeconvolution32fBf16Gemm::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            Simd::SynetDeconvolution32f::SetParams(weight, internal, bias, params);
+            _convolution->SetParams(weight, internal, NULL, NULL);
+        }
+
+        void SynetDeconvolution32fBf16Gemm::Forward(const float* src, float* buf, float* dst)
+        {
+            const DeconvParam32f& p = _param;
+            buf = Buffer(buf);
+            float* gemm = _is1x1 ? NULL : buf;
+            buf += _is1x1 ? 0 : _sizeB * _merge;
+            for (size_t b = 0; b < _batch; b += _merge)
+            {
+                _convolution->Forward(src, buf, _is1x1 ? dst : gemm);
+                for (size_t m = 0; m < _merge; ++m)
+                {
+                    if (!_is1x1)
+                        RowToImg(gemm + m * _sizeB, dst + m * _sizeD);
+                    _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                }
+                src += _sizeS * _merge;
+                dst += _sizeD * _merge;
+            }
+        }
+
+        bool SynetDeconvolution32fBf16Gemm::Preferable(const DeconvParam32f& p)
+        {
+            return p.trans && p.group == 1;
+        }
+
+        //---------------------------------------------------------------------
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam32f param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
-            if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
+            if (Bf16Soft(compatibility) && SynetDeconvolution32fBf16Gemm::Preferable(param))
+                return new SynetDeconvolution32fBf16Gemm(param, Base::SynetConvolution32fInit, Base::ConvolutionBiasAndActivation);
+            else if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
                 return new SynetDeconvolution32fGemmNN(param);
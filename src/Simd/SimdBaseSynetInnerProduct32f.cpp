@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdSynetInnerProduct32f.h"
 #include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
 
@@ -210,11 +211,76 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        SynetInnerProduct32fBf16::SynetInnerProduct32fBf16(const InnerProductParam32f& p, ConvolutionInitPtr init)
+            : SynetInnerProduct32f(p)
+        {
+            SimdConvolutionParameters conv;
+            conv.srcC = p.input;
+            conv.srcH = p.batch;
+            conv.srcW = 1;
+            conv.srcT = SimdTensorData32f;
+            conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = p.output;
+            conv.dstH = p.batch;
+            conv.dstW = 1;
+            conv.dstT = SimdTensorData32f;
+            conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.group = 1;
+            conv.activation = p.activation;
+            _convolution = (Simd::SynetConvolution32f*)init(1, &conv, p.compatibility);
+        }
+
+        SynetInnerProduct32fBf16::~SynetInnerProduct32fBf16()
+        {
+            delete _convolution;
+        }
+
+        size_t SynetInnerProduct32fBf16::InternalBufferSize() const
+        {
+            return _convolution->InternalBufferSize() + _buffer.size;
+        }
+
+        void SynetInnerProduct32fBf16::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            Simd::SynetInnerProduct32f::SetParams(weight, internal, bias, params);
+            Array32f buffer;
+            if (_param.transpose)
+            {
+                size_t K = _param.input, N = _param.output;
+                buffer.Resize(N * K);
+                for (size_t k = 0; k < K; ++k)
+                    for (size_t j = 0; j < N; ++j)
+                        buffer[k * N + j] = weight[j * K + k];
+                weight = buffer.data;
+            }
+            _convolution->SetParams(weight, internal, bias, params);
+            _buffer.Resize(_convolution->ExternalBufferSize());
+        }
+
+        void SynetInnerProduct32fBf16::Forward(const float* src, float* dst)
+        {
+            _convolution->Forward(src, _buffer.data, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
+            InnerProductParam32f param(batch, input, output, transpose, activation, compatibility);
             if (!param.Valid())
                 return NULL;
+            if (Bf16Soft(compatibility))
+                return new SynetInnerProduct32fBf16(param, Base::SynetConvolution32fInit);
             return new SynetInnerProduct32fGemm(param);
         }
     }
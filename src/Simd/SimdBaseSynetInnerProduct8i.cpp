@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurer* SynetInnerProduct8i::Perf(const char* func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    namespace Base
+    {
+        SynetInnerProduct8iConv::SynetInnerProduct8iConv(const InnerProductParam8i& p, ConvolutionInitPtr init)
+            : Simd::SynetInnerProduct8i(p)
+        {
+            SimdConvolutionParameters conv;
+            conv.srcC = p.input;
+            conv.srcH = p.batch;
+            conv.srcW = 1;
+            conv.srcT = p.srcT;
+            conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = p.output;
+            conv.dstH = p.batch;
+            conv.dstW = 1;
+            conv.dstT = p.dstT;
+            conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.group = 1;
+            conv.activation = p.activation;
+            _convolution = (Simd::SynetConvolution8i*)init(1, &conv, p.compatibility);
+        }
+
+        SynetInnerProduct8iConv::~SynetInnerProduct8iConv()
+        {
+            delete _convolution;
+        }
+
+        void SynetInnerProduct8iConv::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+        {
+            Array32f buffer;
+            if (_param.transpose)
+            {
+                size_t K = _param.input, N = _param.output;
+                buffer.Resize(N * K);
+                for (size_t k = 0; k < K; ++k)
+                    for (size_t j = 0; j < N; ++j)
+                        buffer[k * N + j] = weight[j * K + k];
+                weight = buffer.data;
+            }
+            _convolution->SetParams(weight, bias, params, stats);
+        }
+
+        void SynetInnerProduct8iConv::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            _convolution->Forward(src, buf, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInnerProduct8iConv(param, Base::SynetConvolution8iInit);
+        }
+    }
+#endif
+}
@@ -27,6 +27,7 @@
 #include "Simd/SimdUpdate.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -113,8 +114,22 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE size_t SrcBegH(const SimdConvolutionParameters& p, size_t dstY)
+        {
+            return dstY * p.strideY > p.padY ? dstY * p.strideY - p.padY : 0;
+        }
+
+        SIMD_INLINE size_t SrcEndH(const SimdConvolutionParameters& p, size_t dstY)
+        {
+            size_t srcY = (dstY - 1) * p.strideY + (p.kernelY - 1) * p.dilationY + 1;
+            return srcY > p.padY ? Simd::Min(srcY - p.padY, p.srcH) : 0;
+        }
+
+        //---------------------------------------------------------------------
+
         SynetMergedConvolution32f::SynetMergedConvolution32f(const MergConvParam32f& p)
            : Simd::SynetMergedConvolution32f(p)
+           , _threads(1)
         {
             for (size_t i = 0; i < 4; ++i)
                 _convolution[i] = NULL;
@@ -145,7 +160,7 @@ namespace Simd
 
         size_t SynetMergedConvolution32f::ExternalBufferSize() const
         {
-            return _sizeB[0] + _sizeB[1];
+            return (_sizeB[0] + _sizeB[1]) * _threads;
         }
 
         size_t SynetMergedConvolution32f::InternalBufferSize() const
@@ -259,6 +274,20 @@ namespace Simd
             }
         }
 
+        void SynetMergedConvolution32f::SetThreads(size_t minRows)
+        {
+            const MergConvParam32f& p = _param;
+            size_t macs = 0;
+            for (size_t i = 0; i < p.count; ++i)
+            {
+                const SimdConvolutionParameters& c = p.conv[i];
+                macs += c.dstH * c.dstW * c.dstC * c.kernelY * c.kernelX * c.srcC / c.group;
+            }
+            _threads = 1;
+            if (macs >= 1024 * 1024)
+                _threads = Simd::RestrictRange<size_t>(p.conv[p.count - 1].dstH / minRows, 1, Base::GetThreadNumber());
+        }
+
         //---------------------------------------------------------------------
 
         SynetMergedConvolution32fCdc::SynetMergedConvolution32fCdc(const MergConvParam32f & p)
@@ -301,6 +330,7 @@ namespace Simd
             _dw[0] = p.conv[0].kernelY*p.conv[0].kernelX*p.conv[0].srcC;
             _dw[1] = p.conv[1].kernelY*p.conv[1].kernelX;
             _dw[2] = AlignHiAny(p.conv[2].dstC, 2 * _miC);
+            SetThreads(Simd::Max<size_t>(2 * (p.conv[1].kernelY - p.conv[1].strideY), 1));
         }
 
         void SynetMergedConvolution32fCdc::ReorderFirstWeight(const float * src, float * dst) const
@@ -374,33 +404,45 @@ namespace Simd
             }
             const MergConvParam32f & p = _param;
             float * buf0 = Buffer(buf);
-            float * buf1 = buf0 + _sizeB[0];
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber());
             for (size_t b = 0; b < p.conv[0].batch; ++b)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                Simd::Parallel(0, p.conv[1].dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    Forward(src, yBeg, yEnd, buf0 + thread * (_sizeB[0] + _sizeB[1]), dst);
+                }, threads);
+                src += _sizeS;
+                dst += _sizeD;
+            }
+        }
+
+        void SynetMergedConvolution32fCdc::Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst)
+        {
+            const MergConvParam32f& p = _param;
+            float* buf0 = buf;
+            float* buf1 = buf0 + _sizeB[0];
+            size_t yMax0 = SrcEndH(p.conv[1], yEnd);
+            for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+            {
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg1 = yBeg, yBeg0 = SrcBegH(p.conv[1], yBeg); yBeg1 < yEnd;)
+                {
+                    size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], yEnd);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], SrcEndH(p.conv[1], yEnd1)), yMax0);
+                    _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
+                    if (p.add && c == 0)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
-                        if (p.add && c == 0)
-                        {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float)*size);
-                        }
-                        if(c + maC == C)
-                            _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
+                        memcpy(dst + offset, src + offset, sizeof(float)*size);
                     }
+                    if(c + maC == C)
+                        _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
+                    else
+                        _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -449,6 +491,7 @@ namespace Simd
             _dp[1] = p.conv[1].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dw[0] = p.conv[0].kernelY * p.conv[0].kernelX * p.conv[0].srcC;
             _dw[1] = p.conv[1].kernelY * p.conv[1].kernelX;
+            SetThreads(Simd::Max<size_t>(2 * (p.conv[1].kernelY - p.conv[1].strideY), 1));
         }
 
         void SynetMergedConvolution32fCd::ReorderFirstWeight(const float* src, float* dst) const
@@ -498,26 +541,38 @@ namespace Simd
             }
             const MergConvParam32f& p = _param;
             float* buf0 = Buffer(buf);
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber());
             for (size_t b = 0; b < p.conv[0].batch; ++b)
             {
-                for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                Simd::Parallel(0, p.conv[1].dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
-                    {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
-                }
+                    Forward(src, yBeg, yEnd, buf0 + thread * _sizeB[0], dst);
+                }, threads);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
+        void SynetMergedConvolution32fCd::Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst)
+        {
+            const MergConvParam32f& p = _param;
+            float* buf0 = buf;
+            size_t yMax0 = SrcEndH(p.conv[1], yEnd);
+            for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+            {
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg1 = yBeg, yBeg0 = SrcBegH(p.conv[1], yBeg); yBeg1 < yEnd;)
+                {
+                    size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], yEnd);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], SrcEndH(p.conv[1], yEnd1)), yMax0);
+                    _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
+                }
+            }
+        }
+
         bool SynetMergedConvolution32fCd::Preferable(const MergConvParam32f& p)
         {
             return p.count == 2 && p.conv[0].group == 1;
@@ -562,6 +617,7 @@ namespace Simd
             _dp[0] = p.conv[0].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dw[0] = p.conv[0].kernelY * p.conv[0].kernelX;
             _dw[1] = AlignHiAny(p.conv[1].dstC, 2 * _miC);
+            SetThreads(1);
         }
 
         void SynetMergedConvolution32fDc::ReorderFirstWeight(const float* src, float* dst) const
@@ -616,27 +672,38 @@ namespace Simd
             }
             const MergConvParam32f& p = _param;
             float* buf0 = Buffer(buf);
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber());
             for (size_t b = 0; b < p.conv[0].batch; ++b)
             {
-                for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
+                Simd::Parallel(0, p.conv[0].dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg0 = 0; yBeg0 < p.conv[0].dstH;)
-                    {
-                        size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], p.conv[0].dstH);
-                        _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        if (c + maC == C)
-                            _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
-                        else
-                            _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
-                        yBeg0 = yEnd0;
-                    }
-                }
+                    Forward(src, yBeg, yEnd, buf0 + thread * _sizeB[0], dst);
+                }, threads);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
+        void SynetMergedConvolution32fDc::Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst)
+        {
+            const MergConvParam32f& p = _param;
+            float* buf0 = buf;
+            for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
+            {
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg0 = yBeg; yBeg0 < yEnd;)
+                {
+                    size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], yEnd);
+                    _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                    if (c + maC == C)
+                        _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
+                    else
+                        _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
+                    yBeg0 = yEnd0;
+                }
+            }
+        }
+
         bool SynetMergedConvolution32fDc::Preferable(const MergConvParam32f& p)
         {
             return p.count == 2 && p.conv[1].group == 1;
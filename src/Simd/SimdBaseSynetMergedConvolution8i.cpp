@@ -29,6 +29,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -40,6 +41,17 @@ namespace Simd
             size = Simd::Max(size, AlignHi(value, SIMD_ALIGN));
         }
 
+        SIMD_INLINE size_t SrcBegH(const ConvParam8i& p, size_t dstY)
+        {
+            return dstY * p.strideY > p.padY ? dstY * p.strideY - p.padY : 0;
+        }
+
+        SIMD_INLINE size_t SrcEndH(const ConvParam8i& p, size_t dstY)
+        {
+            size_t srcY = (dstY - 1) * p.strideY + (p.kernelY - 1) * p.dilationY + 1;
+            return srcY > p.padY ? Simd::Min(srcY - p.padY, p.srcH) : 0;
+        }
+
         void Convert8uTo32f(const uint8_t* src, size_t maC, size_t yBeg, size_t yEnd, size_t width, size_t channels,
             const float* scale, const float* shift, float* dst, size_t bufH, SimdSynetCompatibilityType compatibility)
         {
@@ -60,6 +72,7 @@ namespace Simd
 
         SynetMergedConvolution8i::SynetMergedConvolution8i(const MergConvParam8i& p)
            :  _param(p)
+           , _threads(1)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
            , _perf(NULL)
 #endif        
@@ -124,7 +137,7 @@ namespace Simd
 
         size_t SynetMergedConvolution8i::ExternalBufferSize() const
         {
-            return (_sizeB[0] + _sizeB[1] + _sizeB[4]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN;
+            return ThreadBufferSize() * _threads + _sizeB[4] * 4 + SIMD_ALIGN;
         }
 
         size_t SynetMergedConvolution8i::InternalBufferSize() const
@@ -292,12 +305,32 @@ namespace Simd
         }
 #endif
 
+        void SynetMergedConvolution8i::SetThreads(size_t minRows)
+        {
+            const MergConvParam8i& p = _param;
+            size_t macs = 0;
+            for (size_t i = 0; i < p.count; ++i)
+            {
+                const ConvParam8i& c = p.conv[i];
+                macs += c.dstH * c.dstW * c.dstC * c.kernelY * c.kernelX * c.srcC / c.group;
+            }
+            _threads = 1;
+            if (macs >= 1024 * 1024)
+                _threads = Simd::RestrictRange<size_t>(p.conv[p.count - 1].dstH / minRows, 1, Base::GetThreadNumber());
+        }
+
+        size_t SynetMergedConvolution8i::ThreadBufferSize() const
+        {
+            return AlignHi(_sizeB[0] * 4, SIMD_ALIGN) + AlignHi(_sizeB[1] * 4, SIMD_ALIGN) + AlignHi(_sizeB[2], SIMD_ALIGN) + AlignHi(_sizeB[3], SIMD_ALIGN);
+        }
+
         uint8_t* SynetMergedConvolution8i::GetBuffer(uint8_t* buffer)
         {
             if (buffer)
                 return buffer;
             else
             {
+                assert(ExternalBufferSize() == 0 || !Base::SynetGetStrictBuffer());
                 _buffer.Resize(ExternalBufferSize());
                 return _buffer.data;
             }
@@ -492,6 +525,27 @@ namespace Simd
         }
 
         void SynetMergedConvolution8iCdc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const MergConvParam8i& p = _param;
+            const ConvParam8i& c0 = p.conv[0];
+            const ConvParam8i& c1 = p.conv[1];
+
+            buf = GetBuffer(buf);
+            int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber()), size = ThreadBufferSize();
+
+            for (size_t b = 0; b < c0.batch; ++b)
+            {
+                Simd::Parallel(0, c1.dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    Forward(src, yBeg, yEnd, buf + thread * size, buf4, dst);
+                }, threads);
+                src += _sizeS * (_s8u ? 1 : 4);
+                dst += _sizeD * (_d8u ? 1 : 4);
+            }
+        }
+
+        void SynetMergedConvolution8iCdc::Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, int32_t* sum, uint8_t* dst)
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
@@ -499,41 +553,36 @@ namespace Simd
             const ConvParam8i& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             uint8_t* buf3 = Allocate<uint8_t>(buf, _sizeB[3]);
-            int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
+            size_t yMax1 = SrcEndH(c1, yEnd), yMax0 = SrcEndH(c0, yMax1);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                size_t yBeg2 = yBeg, yBeg1 = SrcBegH(c1, yBeg2), yBeg0 = SrcBegH(c0, yBeg1);
+                while (yBeg2 < yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
-                            _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
-                        if (c + maC == C)
-                            _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
+                    size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], yEnd);
+                    size_t yEnd1 = Simd::Min(Simd::Max(yBeg1 + a.yStep[1], SrcEndH(c1, yEnd2)), yMax1);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + a.yStep[0], SrcEndH(c0, yEnd1)), yMax0);
+                    if (!_s8u)
+                        _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                    _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                    _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
+                        _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
+                    if (c + maC == C)
+                        _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
+                            _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : sum, dst, maC == C ? 1 : 0);
+                    else
+                        _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
+                            _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, sum, dst, c == 0 ? 1 : 0);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -548,6 +597,8 @@ namespace Simd
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
+            SetThreads(Simd::Max<size_t>(2 * (c1.kernelY - c1.strideY), 1));
+            size_t halo = _threads > 1 ? c1.padY * c0.strideY + c0.padY : 0;
             const ConvParam8i& c2 = p.conv[2];
             AlgParam & a = _alg;
             a.miC = F;
@@ -571,7 +622,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
+                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0] + halo)) * (_s8u ? 0 : 1);
 
                 _sizeB[2] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[0] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -601,38 +652,54 @@ namespace Simd
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
-            const AlgParam& a = _alg;
 
             buf = GetBuffer(buf);
-            float* buf0 = Allocate<float>(buf, _sizeB[0]);
-            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber()), size = ThreadBufferSize();
 
             for (size_t b = 0; b < c0.batch; ++b)
             {
-                for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+                Simd::Parallel(0, c1.dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
-                            _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
-                    }
-                }
+                    Forward(src, yBeg, yEnd, buf + thread * size, dst);
+                }, threads);
                 src += _sizeS * (_s8u ? 1 : 4);
                 dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
+        void SynetMergedConvolution8iCd::Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst)
+        {
+            const MergConvParam8i& p = _param;
+            const ConvParam8i& c0 = p.conv[0];
+            const ConvParam8i& c1 = p.conv[1];
+            const AlgParam& a = _alg;
+
+            float* buf0 = Allocate<float>(buf, _sizeB[0]);
+            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
+            size_t yMax1 = SrcEndH(c1, yEnd), yMax0 = SrcEndH(c0, yMax1);
+
+            for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
+            {
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                size_t yBeg2 = yBeg, yBeg1 = SrcBegH(c1, yBeg2), yBeg0 = SrcBegH(c0, yBeg1);
+                while (yBeg2 < yEnd)
+                {
+                    size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], yEnd);
+                    size_t yEnd1 = Simd::Min(Simd::Max(yBeg1 + a.yStep[1], SrcEndH(c1, yEnd2)), yMax1);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + a.yStep[0], SrcEndH(c0, yEnd1)), yMax0);
+                    if (!_s8u)
+                        _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                    _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
+                        _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                    _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
+                        _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
+                }
+            }
+        }
+
         bool SynetMergedConvolution8iCd::Preferable(const MergConvParam8i& p)
         {
             return p.count == 2 && p.conv[0].group == 1;
@@ -644,6 +711,8 @@ namespace Simd
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
+            SetThreads(Simd::Max<size_t>(2 * (c1.kernelY - c1.strideY), 1));
+            size_t halo = _threads > 1 ? c1.padY * c0.strideY + c0.padY : 0;
             AlgParam& a = _alg;
             a.miC = F;
             size_t size = 0;
@@ -666,7 +735,7 @@ namespace Simd
 
                 a.yStep[0] = a.yStep[1] * c0.strideY;
                 a.yStart[0] = Simd::Min((a.yStart[1] - 1) * c0.strideY + c0.kernelY - c0.padY, c0.srcH);
-                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0])) * (_s8u ? 0 : 1);
+                a.bufH[0] = Pow2Hi(Simd::Max((a.yStep[1] - 1) * c0.strideY + c0.kernelY, a.yStart[0] + halo)) * (_s8u ? 0 : 1);
 
                 _sizeB[2] = a.bufH[0] * p.conv[0].srcW * p.conv[0].srcC;
                 _sizeB[0] = a.bufH[1] * p.conv[1].srcW * a.maC;
@@ -695,43 +764,58 @@ namespace Simd
         {
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
-            const ConvParam8i& c1 = p.conv[1];
-            const AlgParam& a = _alg;
 
             buf = GetBuffer(buf);
-            float* buf0 = Allocate<float>(buf, _sizeB[0]);
-            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
+            size_t threads = Simd::Min(_threads, Base::GetThreadNumber()), size = ThreadBufferSize();
 
             for (size_t b = 0; b < c0.batch; ++b)
             {
-                for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+                Simd::Parallel(0, c0.dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
                 {
-                    size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c0.dstH;)
-                    {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        if (_s8u)
-                            _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
-                                _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
-                        _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                    }
-                }
+                    Forward(src, yBeg, yEnd, buf + thread * size, buf4, dst);
+                }, threads);
                 src += _sizeS * (_s8u ? 1 : 4);
                 dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
+        void SynetMergedConvolution8iDc::Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, int32_t* sum, uint8_t* dst)
+        {
+            const MergConvParam8i& p = _param;
+            const ConvParam8i& c0 = p.conv[0];
+            const ConvParam8i& c1 = p.conv[1];
+            const AlgParam& a = _alg;
+
+            float* buf0 = Allocate<float>(buf, _sizeB[0]);
+            uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
+            size_t yMax1 = SrcEndH(c0, yEnd);
+
+            for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
+            {
+                size_t maC = Simd::Min(C, c + a.maC) - c;
+                size_t yBeg2 = yBeg, yBeg1 = SrcBegH(c0, yBeg2);
+                while (yBeg2 < yEnd)
+                {
+                    size_t yEnd2 = Simd::Min(yBeg2 + a.yStep[2], yEnd);
+                    size_t yEnd1 = Simd::Min(Simd::Max(yBeg1 + a.yStep[1], SrcEndH(c0, yEnd2)), yMax1);
+                    if (_s8u)
+                        _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
+                            _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
+                    _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
+                        _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
+                    if (c + maC == C)
+                        _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                            _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, maC == C ? NULL : sum, dst, maC == C ? 1 : 0);
+                    else
+                        _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                            _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, sum, dst, c == 0 ? 1 : 0);
+                    yBeg2 = yEnd2;
+                    yBeg1 = yEnd1;
+                }
+            }
+        }
+
         bool SynetMergedConvolution8iDc::Preferable(const MergConvParam8i& p)
         {
             return p.count == 2 && p.conv[1].group == 1;
@@ -743,6 +827,7 @@ namespace Simd
             const MergConvParam8i& p = _param;
             const ConvParam8i& c0 = p.conv[0];
             const ConvParam8i& c1 = p.conv[1];
+            SetThreads(1);
             AlgParam& a = _alg;
             a.miC = F;
             size_t size = 0;
@@ -0,0 +1,425 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetNetwork.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetMergedConvolution32f.h"
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdSynetMergedConvolution8i.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAlignment.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetNetwork::SynetNetwork()
+        : _eltwise(NULL)
+        , _softmax(NULL)
+        , _poolingAverage(NULL)
+        , _poolingMax(NULL)
+        , _scratch(0)
+        , _arena(0)
+        , _planned(false)
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        , _perf(NULL)
+#endif
+    {
+    }
+
+    SynetNetwork::~SynetNetwork()
+    {
+        for (size_t i = 0; i < _layers.size(); ++i)
+        {
+            delete _layers[i]->context;
+            delete _layers[i];
+        }
+    }
+
+    size_t SynetNetwork::AddInput(size_t size)
+    {
+        if (_planned || size == 0)
+            return INVALID;
+        Tensor32f tensor;
+        tensor.size = size;
+        tensor.birth = 0;
+        tensor.death = 0;
+        tensor.offset = 0;
+        _tensors.push_back(tensor);
+        return _tensors.size() - 1;
+    }
+
+    size_t SynetNetwork::AddConvolution32f(void* context, size_t src)
+    {
+        SynetConvolution32f* convolution = (SynetConvolution32f*)context;
+        if (convolution == NULL || !ValidSrc(src))
+            return INVALID;
+        const ConvParam32f& p = convolution->Param();
+        if (_tensors[src].size != p.batch * p.srcC * p.srcH * p.srcW)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerConvolution32f;
+        layer->context = convolution;
+        layer->src.push_back(src);
+        _scratch = Max(_scratch, convolution->ExternalBufferSize());
+        return AddLayer(layer, p.batch * p.dstC * p.dstH * p.dstW);
+    }
+
+    size_t SynetNetwork::AddDeconvolution32f(void* context, size_t src)
+    {
+        SynetDeconvolution32f* deconvolution = (SynetDeconvolution32f*)context;
+        if (deconvolution == NULL || !ValidSrc(src))
+            return INVALID;
+        const DeconvParam32f& p = deconvolution->Param();
+        if (_tensors[src].size != p.batch * p.srcC * p.srcH * p.srcW)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerDeconvolution32f;
+        layer->context = deconvolution;
+        layer->src.push_back(src);
+        _scratch = Max(_scratch, deconvolution->ExternalBufferSize());
+        return AddLayer(layer, p.batch * p.dstC * p.dstH * p.dstW);
+    }
+
+    size_t SynetNetwork::AddInnerProduct32f(void* context, size_t src)
+    {
+        SynetInnerProduct32f* innerProduct = (SynetInnerProduct32f*)context;
+        if (innerProduct == NULL || !ValidSrc(src))
+            return INVALID;
+        const InnerProductParam32f& p = innerProduct->Param();
+        if (_tensors[src].size != p.batch * p.input)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerInnerProduct32f;
+        layer->context = innerProduct;
+        layer->src.push_back(src);
+        return AddLayer(layer, p.batch * p.output);
+    }
+
+    size_t SynetNetwork::AddMergedConvolution32f(void* context, size_t src)
+    {
+        SynetMergedConvolution32f* merged = (SynetMergedConvolution32f*)context;
+        if (merged == NULL || !ValidSrc(src))
+            return INVALID;
+        const MergConvParam32f& p = merged->Param();
+        const ConvParam32f& beg = p.conv[0], & end = p.conv[p.count - 1];
+        if (_tensors[src].size != beg.batch * beg.srcC * beg.srcH * beg.srcW)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerMergedConvolution32f;
+        layer->context = merged;
+        layer->src.push_back(src);
+        _scratch = Max(_scratch, merged->ExternalBufferSize());
+        return AddLayer(layer, end.batch * end.dstC * end.dstH * end.dstW);
+    }
+
+    size_t SynetNetwork::AddEltwise32f(const size_t* src, size_t count, const float* weight, SimdSynetEltwiseOperationType type)
+    {
+        if (src == NULL || count < 2 || type < SimdSynetEltwiseOperationProduct || type > SimdSynetEltwiseOperationMin)
+            return INVALID;
+        for (size_t i = 0; i < count; ++i)
+            if (!ValidSrc(src[i]) || _tensors[src[i]].size != _tensors[src[0]].size)
+                return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerEltwise32f;
+        layer->context = NULL;
+        layer->src.assign(src, src + count);
+        layer->eltwise = type;
+        if (type == SimdSynetEltwiseOperationSum)
+        {
+            layer->weight.Resize(count);
+            for (size_t i = 0; i < count; ++i)
+                layer->weight[i] = weight ? weight[i] : 1.0f;
+        }
+        return AddLayer(layer, _tensors[src[0]].size);
+    }
+
+    size_t SynetNetwork::AddSoftmax32f(size_t src, size_t outer, size_t count, size_t inner)
+    {
+        if (!ValidSrc(src) || _tensors[src].size != outer * count * inner)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = LayerSoftmax32f;
+        layer->context = NULL;
+        layer->src.push_back(src);
+        layer->outer = outer;
+        layer->count = count;
+        layer->inner = inner;
+        return AddLayer(layer, _tensors[src].size);
+    }
+
+    size_t SynetNetwork::AddPooling32f(size_t src, size_t batch, const SimdConvolutionParameters* pooling, SimdBool max, SimdBool excludePad)
+    {
+        if (pooling == NULL || !ValidSrc(src) || pooling->srcC != pooling->dstC || pooling->srcF != pooling->dstF ||
+            _tensors[src].size != batch * pooling->srcC * pooling->srcH * pooling->srcW)
+            return INVALID;
+        Layer* layer = new Layer();
+        layer->type = max ? LayerPoolingMax32f : LayerPoolingAverage32f;
+        layer->context = NULL;
+        layer->src.push_back(src);
+        layer->batch = batch;
+        layer->pooling = *pooling;
+        layer->excludePad = excludePad;
+        return AddLayer(layer, batch * pooling->dstC * pooling->dstH * pooling->dstW);
+    }
+
+    size_t SynetNetwork::AddLayer(Layer* layer, size_t size)
+    {
+        Tensor32f tensor;
+        tensor.size = size;
+        tensor.birth = _layers.size() + 1;
+        tensor.death = tensor.birth;
+        tensor.offset = 0;
+        layer->dst = _tensors.size();
+        _tensors.push_back(tensor);
+        _layers.push_back(layer);
+        return layer->dst;
+    }
+
+    bool SynetNetwork::ValidSrc(size_t src) const
+    {
+        return !_planned && src < _tensors.size();
+    }
+
+    bool SynetNetwork::Plan(const size_t* outputs, size_t count)
+    {
+        if (_planned || _layers.empty())
+            return false;
+        for (size_t i = 0; i < count; ++i)
+            if (outputs[i] >= _tensors.size())
+                return false;
+        for (size_t l = 0; l < _layers.size(); ++l)
+            for (size_t s = 0; s < _layers[l]->src.size(); ++s)
+                _tensors[_layers[l]->src[s]].death = l + 1;
+        for (size_t i = 0; i < count; ++i)
+            _tensors[outputs[i]].death = _layers.size() + 1;
+
+        const size_t align = Alignment() / sizeof(float);
+        std::vector<size_t> order(_tensors.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) { return _tensors[a].size > _tensors[b].size; });
+        _scratch = AlignHi(_scratch, align);
+        _arena = _scratch;
+        std::vector<size_t> placed;
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            Tensor32f& curr = _tensors[order[i]];
+            std::vector<std::pair<size_t, size_t>> busy;
+            for (size_t j = 0; j < placed.size(); ++j)
+            {
+                const Tensor32f& prev = _tensors[placed[j]];
+                if (prev.birth <= curr.death && curr.birth <= prev.death)
+                    busy.push_back(std::make_pair(prev.offset, prev.offset + AlignHi(prev.size, align)));
+            }
+            std::sort(busy.begin(), busy.end());
+            size_t offset = _scratch, size = AlignHi(curr.size, align);
+            for (size_t j = 0; j < busy.size(); ++j)
+            {
+                if (offset + size <= busy[j].first)
+                    break;
+                offset = Max(offset, busy[j].second);
+            }
+            curr.offset = offset;
+            _arena = Max(_arena, offset + size);
+            placed.push_back(order[i]);
+        }
+        _buffer.Resize(_arena, false, Alignment());
+        _planned = true;
+        for (size_t l = 0; l < _layers.size(); ++l)
+        {
+            Layer& layer = *_layers[l];
+            layer.ptrs.resize(layer.src.size());
+            for (size_t s = 0; s < layer.src.size(); ++s)
+                layer.ptrs[s] = Tensor(layer.src[s]);
+        }
+        return true;
+    }
+
+    size_t SynetNetwork::InternalBufferSize() const
+    {
+        return _buffer.RawSize();
+    }
+
+    float* SynetNetwork::Tensor(size_t tensor)
+    {
+        if (!_planned || tensor >= _tensors.size())
+            return NULL;
+        return _buffer.data + _tensors[tensor].offset;
+    }
+
+    void SynetNetwork::Forward()
+    {
+        assert(_planned);
+        float* buf = _buffer.data;
+        for (size_t l = 0; l < _layers.size(); ++l)
+        {
+            const Layer& layer = *_layers[l];
+            const float* src = Tensor(layer.src[0]);
+            float* dst = Tensor(layer.dst);
+            switch (layer.type)
+            {
+            case LayerConvolution32f:
+            {
+                SynetConvolution32f* convolution = (SynetConvolution32f*)layer.context;
+                Base::ThreadNumberScope scope(convolution->ThreadNumber());
+                convolution->Forward(src, buf, dst);
+                break;
+            }
+            case LayerDeconvolution32f:
+            {
+                SynetDeconvolution32f* deconvolution = (SynetDeconvolution32f*)layer.context;
+                Base::ThreadNumberScope scope(deconvolution->ThreadNumber());
+                deconvolution->Forward(src, buf, dst);
+                break;
+            }
+            case LayerInnerProduct32f:
+                ((SynetInnerProduct32f*)layer.context)->Forward(src, dst);
+                break;
+            case LayerMergedConvolution32f:
+                ((SynetMergedConvolution32f*)layer.context)->Forward(src, buf, dst);
+                break;
+            case LayerEltwise32f:
+                _eltwise(layer.ptrs.data(), layer.weight.data, layer.src.size(), _tensors[layer.dst].size, layer.eltwise, dst);
+                break;
+            case LayerSoftmax32f:
+                _softmax(src, layer.outer, layer.count, layer.inner, dst);
+                break;
+            case LayerPoolingAverage32f:
+            case LayerPoolingMax32f:
+            {
+                const SimdConvolutionParameters& p = layer.pooling;
+                size_t srcSize = p.srcC * p.srcH * p.srcW, dstSize = p.dstC * p.dstH * p.dstW;
+                for (size_t b = 0; b < layer.batch; ++b)
+                {
+                    if (layer.type == LayerPoolingMax32f)
+                        _poolingMax(src + b * srcSize, p.srcC, p.srcH, p.srcW, 1, p.kernelY, p.kernelX, 1, p.strideY, p.strideX,
+                            0, p.padY, p.padX, dst + b * dstSize, p.dstC, p.dstH, p.dstW, p.srcF);
+                    else
+                        _poolingAverage(src + b * srcSize, p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+                            p.padY, p.padX, dst + b * dstSize, p.dstH, p.dstW, layer.excludePad, p.srcF);
+                }
+                break;
+            }
+            default:
+                assert(0);
+            }
+        }
+    }
+
+    const char* SynetNetwork::Info() const
+    {
+        std::stringstream ss;
+        ss << Ext() << "::SynetNetwork [layers: " << _layers.size() << ", tensors: " << _tensors.size();
+        ss << ", arena: " << _arena * sizeof(float) << " bytes]";
+        _info = ss.str();
+        return _info.c_str();
+    }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurer* SynetNetwork::Perf(const char* func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Info());
+        return _perf;
+    }
+#endif
+
+    namespace Base
+    {
+        SynetNetwork::SynetNetwork()
+        {
+            _eltwise = Base::SynetEltwiseLayerForward;
+            _softmax = Base::SynetSoftmaxLayerForward;
+            _poolingAverage = Base::SynetPoolingAverage;
+            _poolingMax = Base::SynetPoolingMax32f;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetNetworkInit()
+        {
+            return new SynetNetwork();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        std::atomic<bool> g_synetStrictBuffer(false);
+
+        bool SynetGetStrictBuffer()
+        {
+            return g_synetStrictBuffer.load(std::memory_order_relaxed);
+        }
+
+        void SynetSetStrictBuffer(bool strict)
+        {
+            g_synetStrictBuffer.store(strict, std::memory_order_relaxed);
+        }
+
+        static size_t ExternalBufferSize(const void* context, SimdSynetContextType type)
+        {
+            switch (type)
+            {
+            case SimdSynetContextConvolution32f: return ((Simd::SynetConvolution32f*)context)->ExternalBufferSize() * sizeof(float);
+            case SimdSynetContextConvolution8i: return ((Simd::SynetConvolution8i*)context)->ExternalBufferSize();
+            case SimdSynetContextDeconvolution32f: return ((Simd::SynetDeconvolution32f*)context)->ExternalBufferSize() * sizeof(float);
+            case SimdSynetContextInnerProduct32f: return 0;
+            case SimdSynetContextInnerProduct8i: return ((Simd::SynetInnerProduct8i*)context)->ExternalBufferSize();
+            case SimdSynetContextMergedConvolution32f: return ((Simd::SynetMergedConvolution32f*)context)->ExternalBufferSize() * sizeof(float);
+            case SimdSynetContextMergedConvolution8i: return ((Simd::SynetMergedConvolution8i*)context)->ExternalBufferSize();
+            default:
+                assert(0);
+                return 0;
+            }
+        }
+
+        size_t SynetExternalBufferPlan(const void* const* contexts, const SimdSynetContextType* types, size_t count, SimdBool shared, size_t* offsets)
+        {
+            size_t arena = 0, align = Alignment();
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t size = AlignHi(ExternalBufferSize(contexts[i], types[i]), align);
+                if (shared)
+                {
+                    if (offsets)
+                        offsets[i] = 0;
+                    arena = Max(arena, size);
+                }
+                else
+                {
+                    if (offsets)
+                        offsets[i] = arena;
+                    arena += size;
+                }
+            }
+            return arena;
+        }
+    }
+#endif
+}
@@ -21,25 +21,200 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
-#include "Simd/SimdMath.h"
-#include "Simd/SimdBase.h"
-
-#include <thread>
-
-namespace Simd
-{
-    namespace Base
-    {
-        size_t g_threadNumber = 1;
-
-        size_t GetThreadNumber()
-        {
-            return g_threadNumber;
-        }
-
-        void SetThreadNumber(size_t threadNumber)
-        {
-            g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
-        }
-    }
-}
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        std::atomic<size_t> g_threadNumber(1);
+        thread_local size_t t_threadNumber = 0;
+
+        size_t GetThreadNumber()
+        {
+            return t_threadNumber ? t_threadNumber : g_threadNumber.load(std::memory_order_relaxed);
+        }
+
+        void SetThreadNumber(size_t threadNumber)
+        {
+            g_threadNumber.store(Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency()), std::memory_order_relaxed);
+        }
+
+        size_t GetLocalThreadNumber()
+        {
+            return t_threadNumber;
+        }
+
+        void SetLocalThreadNumber(size_t threadNumber)
+        {
+            t_threadNumber = threadNumber ? Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency()) : 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ThreadPool
+        {
+        public:
+            ThreadPool()
+                : _epoch(0)
+                , _sleeping(0)
+                , _stop(false)
+            {
+            }
+
+            ~ThreadPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stop = true;
+                    _wakeup.notify_all();
+                }
+                for (size_t i = 0; i < _workers.size(); ++i)
+                    _workers[i].join();
+            }
+
+            void Execute(SimdTaskFuncPtr task, void* context, size_t number)
+            {
+                size_t workers = std::min<size_t>(number, std::thread::hardware_concurrency()) - 1;
+                if (number <= 1 || workers == 0 || s_inside)
+                {
+                    for (size_t i = 0; i < number; ++i)
+                        task(context, i);
+                    return;
+                }
+
+                Job job(task, context, number, workers);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    while (_workers.size() < workers)
+                        _workers.push_back(std::thread(&ThreadPool::Work, this));
+                    _jobs.push_back(&job);
+                    _epoch.fetch_add(1, std::memory_order_release);
+                    if (_sleeping)
+                        _wakeup.notify_all();
+                }
+                s_inside = true;
+                Run(job);
+                s_inside = false;
+                while (job.done.load(std::memory_order_acquire) < number)
+                    std::this_thread::yield();
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _jobs.erase(std::find(_jobs.begin(), _jobs.end(), &job));
+                }
+                while (job.refs.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+            }
+
+        private:
+            struct Job
+            {
+                SimdTaskFuncPtr task;
+                void* context;
+                size_t number, workers;
+                std::atomic<size_t> next, done, refs;
+
+                Job(SimdTaskFuncPtr t, void* c, size_t n, size_t w)
+                    : task(t), context(c), number(n), workers(w), next(0), done(0), refs(0)
+                {
+                }
+            };
+
+            static const size_t SPIN_COUNT = 1 << 14;
+
+            std::vector<std::thread> _workers;
+            std::vector<Job*> _jobs;
+            std::mutex _mutex;
+            std::condition_variable _wakeup;
+            std::atomic<size_t> _epoch;
+            size_t _sleeping;
+            bool _stop;
+
+            static thread_local bool s_inside;
+
+            static void Run(Job& job)
+            {
+                for (size_t i = job.next++; i < job.number; i = job.next++)
+                {
+                    job.task(job.context, i);
+                    job.done.fetch_add(1, std::memory_order_release);
+                }
+            }
+
+            Job* Take()
+            {
+                for (size_t i = 0; i < _jobs.size(); ++i)
+                {
+                    Job* job = _jobs[i];
+                    if (job->next.load(std::memory_order_relaxed) < job->number && job->refs.load(std::memory_order_relaxed) < job->workers)
+                    {
+                        job->refs++;
+                        return job;
+                    }
+                }
+                return NULL;
+            }
+
+            void Work()
+            {
+                s_inside = true;
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (;;)
+                {
+                    Job* job = Take();
+                    if (job)
+                    {
+                        lock.unlock();
+                        Run(*job);
+                        job->refs.fetch_sub(1, std::memory_order_release);
+                        lock.lock();
+                        continue;
+                    }
+                    if (_stop)
+                        return;
+                    size_t epoch = _epoch.load(std::memory_order_relaxed);
+                    lock.unlock();
+                    for (size_t i = 0; i < SPIN_COUNT && _epoch.load(std::memory_order_acquire) == epoch; ++i);
+                    lock.lock();
+                    if (_epoch.load(std::memory_order_relaxed) == epoch && !_stop)
+                    {
+                        _sleeping++;
+                        _wakeup.wait(lock, [this, epoch] { return _epoch.load(std::memory_order_relaxed) != epoch || _stop; });
+                        _sleeping--;
+                    }
+                }
+            }
+        };
+
+        thread_local bool ThreadPool::s_inside = false;
+
+        std::atomic<SimdExecutorFuncPtr> g_executorFunc(NULL);
+        std::atomic<void*> g_executor(NULL);
+
+        void SetExecutor(SimdExecutorFuncPtr executorFunc, void* executor)
+        {
+            g_executor.store(executor);
+            g_executorFunc.store(executorFunc);
+        }
+
+        void ParallelExecute(SimdTaskFuncPtr task, void* context, size_t number)
+        {
+            SimdExecutorFuncPtr executorFunc = g_executorFunc.load();
+            if (executorFunc)
+                executorFunc(g_executor.load(), task, context, number);
+            else
+            {
+                static ThreadPool pool;
+                pool.Execute(task, context, number);
+            }
+        }
+    }
+}
@@ -38,6 +38,12 @@ namespace Simd
 
     uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
 
+    typedef uint8_t* (*ImageLoadFromMemoryScaledPtr)(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    uint8_t* ImageLoadFromFileScaled(const ImageLoadFromMemoryScaledPtr loader, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    typedef uint8_t* (*ImageLoadFromMemoryRegionPtr)(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
     //-------------------------------------------------------------------------
 
     struct ImageLoaderParam
@@ -46,25 +52,35 @@ namespace Simd
         size_t size;
         SimdImageFileType file;
         SimdPixelFormatType format;
+        size_t scale;
+        size_t left, top, right, bottom; // region of interest (empty region means whole image)
 
-        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f);
+        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc = 1);
 
         bool Validate();
+
+        SIMD_INLINE bool Region() const
+        {
+            return right > left && bottom > top;
+        }
     };
 
     class ImageLoader
     {
-    protected:
+    public:
         typedef Simd::View<Simd::Allocator> Image;
 
+    protected:
         ImageLoaderParam _param;
         InputMemoryStream _stream;
         Image _image;
+        size_t _ready;
         
     public:
         ImageLoader(const ImageLoaderParam& param)
             : _param(param)
             , _stream(_param.data, _param.size)
+            , _ready(0)
         {
         }
 
@@ -74,6 +90,22 @@ namespace Simd
 
         virtual bool FromStream() = 0;
 
+        virtual bool Downscale();
+
+        virtual bool Crop();
+
+        virtual bool Progress(const uint8_t* data, size_t size);
+
+        SIMD_INLINE const Image& Current() const
+        {
+            return _image;
+        }
+
+        SIMD_INLINE size_t Ready() const
+        {
+            return _ready;
+        }
+
         SIMD_INLINE uint8_t* Release(size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
         {
             *stride = _image.stride;
@@ -84,6 +116,30 @@ namespace Simd
         }
     };
 
+    typedef ImageLoader* (*CreateImageLoaderPtr)(const ImageLoaderParam& param);
+
+    class ImageDecoder : public Deletable
+    {
+    public:
+        ImageDecoder(SimdPixelFormatType format, CreateImageLoaderPtr create);
+
+        virtual ~ImageDecoder();
+
+        bool Push(const uint8_t* data, size_t size);
+
+        bool Info(size_t* width, size_t* height, SimdPixelFormatType* format) const;
+
+        size_t Pull(uint8_t* dst, size_t stride, size_t rows);
+
+    private:
+        SimdPixelFormatType _format;
+        CreateImageLoaderPtr _create;
+        ImageLoader* _loader;
+        OutputMemoryStream _buffer;
+        size_t _pulled;
+        bool _error;
+    };
+
     namespace Base
     {
         class ImagePxmLoader : public ImageLoader
@@ -147,6 +203,13 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        namespace Zlib
+        {
+            typedef uint32_t (*Adler32Ptr)(uint8_t* data, int size);
+
+            bool Decode(InputMemoryStream& is, OutputMemoryStream& os, bool parseHeader, Adler32Ptr adler32);
+        }
+
         class ImagePngLoader : public ImageLoader
         {
         public:
@@ -154,6 +217,8 @@ namespace Simd
 
             virtual bool FromStream();
 
+            virtual bool Progress(const uint8_t* data, size_t size);
+
         protected:
             typedef void (*ToAny8Ptr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef void (*ToBgra8Ptr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
@@ -163,6 +228,7 @@ namespace Simd
             ToBgra8Ptr _toBgra8, _bgrToBgra;
             ToAny16Ptr _toAny16;
             ToBgra16Ptr _toBgra16;
+            Zlib::Adler32Ptr _adler32;
 
             virtual void SetConverters();
         private:
@@ -196,12 +262,32 @@ namespace Simd
         public:
             ImageJpegLoader(const ImageLoaderParam& param);
 
+            virtual ~ImageJpegLoader();
+
             virtual bool FromStream();
+
+            virtual bool Downscale();
+
+            virtual bool Crop();
+
+            virtual bool Progress(const uint8_t* data, size_t size);
+
+        private:
+            struct Decoder;
+            Decoder* _decoder;
         };
 
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
+        void* ImageDecoderInit(SimdPixelFormatType format);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -254,6 +340,14 @@ namespace Simd
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
+        void* ImageDecoderInit(SimdPixelFormatType format);
     }
 #endif// SIMD_SSE41_ENABLE
 
@@ -296,9 +390,23 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Sse41::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
+        void* ImageDecoderInit(SimdPixelFormatType format);
     }
 #endif// SIMD_AVX2_ENABLE
 
@@ -341,9 +449,23 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Base::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
+        void* ImageDecoderInit(SimdPixelFormatType format);
     }
 #endif// SIMD_AVX512BW_ENABLE
 
@@ -386,9 +508,23 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Base::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        ImageLoader* CreateImageLoader(const ImageLoaderParam& param);
+
+        void* ImageDecoderInit(SimdPixelFormatType format);
     }
 #endif// SIMD_NEON_ENABLE
 }
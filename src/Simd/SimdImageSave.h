@@ -28,6 +28,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 
+#include <vector>
+
 namespace Simd
 {
     typedef uint8_t* (*ImageSaveToMemoryPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -87,7 +89,7 @@ namespace Simd
                 if (width % 2 != 0 || height % 2 != 0)
                     return false;
             }
-            if (file <= SimdImageFileUndefined || file > SimdImageFileJpeg)
+            if (file <= SimdImageFileUndefined || file > SimdImageFileJpegOptimized)
                 return false;
             return true;
         }
@@ -174,19 +176,27 @@ namespace Simd
             static const int COMPRESSION = 8;
             static const int FILTERS = 5;
             static const int TYPES = 7;
+            static const size_t BLOCK = 256 * 1024;
             typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef uint32_t (*EncodePtr)(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst);
             typedef void (*CompressPtr)(uint8_t* data, int size, int quality, OutputMemoryStream& stream);
+            typedef void (*DeflatePtr)(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream);
+            typedef uint32_t (*Adler32Ptr)(uint8_t* data, int size);
             ConvertPtr _convert;
             EncodePtr _encode[TYPES];
             CompressPtr _compress;
+            DeflatePtr _deflate;
+            Adler32Ptr _adler32;
             size_t _channels, _size;
             Array8u _filt, _buff;
             Array8i _line;
 
+            void CompressBlocks(OutputMemoryStream& zlib);
             void WriteToStream(const uint8_t* zlib, size_t zlen);
         };
 
+        struct JpegHuffman;
+
         class ImageJpegSaver : public ImageSaver
         {
         public:
@@ -215,15 +225,17 @@ namespace Simd
             WriteBlockPtr _writeBlock;
             WriteNv12BlockPtr _writeNv12Block;
             WriteYuv420pBlockPtr _writeYuv420pBlock;
-            bool _subSample;
-            int _quality, _block, _width;
+            bool _subSample, _optimize;
+            int _quality, _block, _width, _rows, _restart;
             float _fY[64], _fUv[64];
             uint8_t _uY[64], _uUv[64];
 
             virtual void Init();
 
             void InitParams(bool trans);
-            void WriteHeader();
+            void WriteHeader(const JpegHuffman* huffman);
+            void WriteData(const std::vector<OutputMemoryStream>& intervals);
+            void WriteRow(OutputMemoryStream& stream, const uint8_t* src, size_t stride, int block, uint8_t* buf, int dc[3]);
         };
 
         //---------------------------------------------------------------------
@@ -67,6 +67,17 @@ namespace Simd
             }
         }; 
 
+        struct JpegHuffman
+        {
+            uint8_t bits[17], vals[256];
+            uint16_t codes[256][2];
+            int count;
+
+            void Init(const uint8_t* cod, const uint8_t* val);
+            void Optimize(const uint32_t* freq);
+            void Write(OutputMemoryStream& stream, uint8_t id) const;
+        };
+
         extern const uint8_t JpegZigZagD[64];
         extern const uint8_t JpegZigZagT[64];
 
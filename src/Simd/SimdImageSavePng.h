@@ -38,6 +38,8 @@ namespace Simd
         extern const uint16_t ZlibDistC[31];
         extern const uint8_t  ZlibDistEb[30];
 
+        uint32_t ZlibAdler32(uint8_t* data, int size);
+
 #if defined(SIMD_PNG_ZLIB_BIT_REV_TABLE)
         const int ZlibBitRevShift = 9;
         const int ZlibBitRevSize = 1 << ZlibBitRevShift;
@@ -117,6 +119,32 @@ namespace Simd
                 ZlibHuff2(bits, stream);
         }
 
+        SIMD_INLINE void ZlibSyncFlush(OutputMemoryStream& stream)
+        {
+            stream.WriteBits(0, 3);
+            stream.FlushBits();
+            stream.WriteBe32u(0x0000FFFF);
+        }
+
+        SIMD_INLINE uint32_t ZlibAdler32Combine(uint32_t adler1, uint32_t adler2, size_t size2)
+        {
+            const uint32_t BASE = 65521;
+            uint32_t rem = uint32_t(size2 % BASE);
+            uint32_t lo = adler1 & 0xFFFF;
+            uint32_t hi = (rem * lo) % BASE;
+            lo += (adler2 & 0xFFFF) + BASE - 1;
+            hi += (adler1 >> 16) + (adler2 >> 16) + BASE - rem;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (hi >= BASE * 2)
+                hi -= BASE * 2;
+            if (hi >= BASE)
+                hi -= BASE;
+            return (hi << 16) | lo;
+        }
+
         SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
         {
             limit = Min(limit, 258);
@@ -152,6 +180,8 @@ namespace Simd
 #ifdef SIMD_SSE41_ENABLE    
     namespace Sse41
     {
+        uint32_t ZlibAdler32(uint8_t* data, int size);
+
         SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
         {
             limit = Min(limit, 258);
@@ -182,6 +212,8 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        uint32_t ZlibAdler32(uint8_t* data, int size);
+
         SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
         {
             limit = Min(limit, 258);
@@ -205,6 +237,8 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
+        uint32_t ZlibAdler32(uint8_t* data, int size);
+
         SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
         {
             limit = Min(limit, 258);
@@ -228,6 +262,7 @@ namespace Simd
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
+        uint32_t ZlibAdler32(uint8_t* data, int size);
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -72,8 +72,10 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
+#include "Simd/SimdSynetNetwork.h"
 #include "Simd/SimdSynetScale8i.h"
 
 #include "Simd/SimdBase.h"
@@ -193,6 +195,21 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API void SimdSetLocalThreadNumber(size_t threadNumber)
+{
+    Base::SetLocalThreadNumber(threadNumber);
+}
+
+SIMD_API void SimdSetExecutor(SimdExecutorFuncPtr executorFunc, void * executor)
+{
+    Base::SetExecutor(executorFunc, executor);
+}
+
+SIMD_API void SimdParallelExecute(SimdTaskFuncPtr task, void * context, size_t number)
+{
+    Base::ParallelExecute(task, context, number);
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE41_ENABLE
@@ -3230,6 +3247,58 @@ SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t
     return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
 }
 
+SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryScaledPtr imageLoadFromMemoryScaled = SIMD_FUNC4(ImageLoadFromMemoryScaled, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageLoadFromMemoryScaled(data, size, scale, stride, width, height, format);
+}
+
+SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryScaledPtr imageLoadFromMemoryScaled = SIMD_FUNC4(ImageLoadFromMemoryScaled, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromFileScaled(imageLoadFromMemoryScaled, path, scale, stride, width, height, format);
+}
+
+SIMD_API uint8_t* SimdImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom,
+    size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryRegionPtr imageLoadFromMemoryRegion = SIMD_FUNC4(ImageLoadFromMemoryRegion, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageLoadFromMemoryRegion(data, size, left, top, right, bottom, stride, width, height, format);
+}
+
+SIMD_API void* SimdImageDecoderInit(SimdPixelFormatType format)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdImageDecoderInitPtr)(SimdPixelFormatType format);
+    const static SimdImageDecoderInitPtr simdImageDecoderInit = SIMD_FUNC4(ImageDecoderInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdImageDecoderInit(format);
+}
+
+SIMD_API SimdBool SimdImageDecoderPush(void* decoder, const uint8_t* data, size_t size)
+{
+    SIMD_EMPTY();
+    return ((ImageDecoder*)decoder)->Push(data, size) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdImageDecoderInfo(const void* decoder, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    return ((const ImageDecoder*)decoder)->Info(width, height, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API size_t SimdImageDecoderPull(void* decoder, uint8_t* dst, size_t stride, size_t rows)
+{
+    SIMD_EMPTY();
+    return ((ImageDecoder*)decoder)->Pull(dst, stride, rows);
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -5817,18 +5886,50 @@ SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * wei
 #endif
 }
 
+SIMD_API void SimdSynetConvolution32fSetAutotune(SimdBool enable, const char * cache)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SynetConvolution32fSetAutotune(enable, cache);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetConvolution32fSetThreadNumber(void * context, size_t threadNumber)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetConvolution32f*)context)->SetThreadNumber(threadNumber);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
     SynetConvolution32f * c = (SynetConvolution32f*)context;
     SIMD_PERF_EXT(c);
+    Base::ThreadNumberScope scope(c->ThreadNumber());
     c->Forward(src, buf, dst);
 #else
     assert(0);
 #endif
 }
 
+SIMD_API void SimdSynetConvolution32fForwardBatch(void * context, const float * src, size_t batch, float * buf, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = (SynetConvolution32f*)context;
+    SIMD_PERF_EXT(c);
+    Base::ThreadNumberScope scope(c->ThreadNumber());
+    c->ForwardBatch(src, batch, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -5903,7 +6004,7 @@ SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutio
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC5(SynetDeconvolution32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC7(SynetDeconvolution32fInit, SIMD_AMX_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
     
     return simdSynetDeconvolution32fInit(batch, params, compatibility);
 #else
@@ -5955,12 +6056,22 @@ SIMD_API void SimdSynetDeconvolution32fSetParams(void * context, const float * w
 #endif
 }
 
+SIMD_API void SimdSynetDeconvolution32fSetThreadNumber(void * context, size_t threadNumber)
+{
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetDeconvolution32f*)context)->SetThreadNumber(threadNumber);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
     SynetDeconvolution32f * d = (SynetDeconvolution32f*)context;
     SIMD_PERF_EXT(d);
+    Base::ThreadNumberScope scope(d->ThreadNumber());
     d->Forward(src, buf, dst);
 #else
     assert(0);
@@ -6110,14 +6221,14 @@ assert(0);
 #endif
 }
 
-SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void* (*SimdSynetInnerProduct32fInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
-    const static SimdSynetInnerProduct32fInitPtr simdSynetInnerProduct32fInit = SIMD_FUNC5(SynetInnerProduct32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    typedef void* (*SimdSynetInnerProduct32fInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetInnerProduct32fInitPtr simdSynetInnerProduct32fInit = SIMD_FUNC7(SynetInnerProduct32fInit, SIMD_AMX_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdSynetInnerProduct32fInit(batch, input, output, transpose, activation);
+    return simdSynetInnerProduct32fInit(batch, input, output, transpose, activation, compatibility);
 #else
     assert(0);
     return 0;
@@ -6183,6 +6294,75 @@ SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_
 #endif
 }
 
+SIMD_API void* SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct8iInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetInnerProduct8iInitPtr simdSynetInnerProduct8iInit = SIMD_FUNC6(SynetInnerProduct8iInit, SIMD_AMX_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetInnerProduct8iInit(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetInnerProduct8i*)context)->SetParams(weight, bias, params, stats);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct8i* ip = (SynetInnerProduct8i*)context;
+    SIMD_PERF_EXT(ip);
+    ip->Forward(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
@@ -6347,6 +6527,196 @@ SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* thres
 #endif
 }
 
+SIMD_API void* SimdSynetNetworkInit()
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetNetworkInitPtr) ();
+    const static SimdSynetNetworkInitPtr simdSynetNetworkInit = SIMD_FUNC4(SynetNetworkInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetNetworkInit();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddInput(void* network, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddInput(size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddConvolution32f(void* network, void* context, size_t src)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddConvolution32f(context, src);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddDeconvolution32f(void* network, void* context, size_t src)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddDeconvolution32f(context, src);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddInnerProduct32f(void* network, void* context, size_t src)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddInnerProduct32f(context, src);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddMergedConvolution32f(void* network, void* context, size_t src)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddMergedConvolution32f(context, src);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddEltwise32f(void* network, const size_t* src, size_t count, const float* weight, SimdSynetEltwiseOperationType type)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddEltwise32f(src, count, weight, type);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddSoftmax32f(void* network, size_t src, size_t outer, size_t count, size_t inner)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddSoftmax32f(src, outer, count, inner);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkAddPooling32f(void* network, size_t src, size_t batch, const SimdConvolutionParameters* pooling, SimdBool max, SimdBool excludePad)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->AddPooling32f(src, batch, pooling, max, excludePad);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetNetworkPlan(void* network, const size_t* outputs, size_t count)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->Plan(outputs, count) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API size_t SimdSynetNetworkInternalBufferSize(const void* network)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetNetworkInfo(const void* network)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API float* SimdSynetNetworkTensor(void* network, size_t tensor)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetNetwork*)network)->Tensor(tensor);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetNetworkForward(void* network)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetNetwork* n = (SynetNetwork*)network;
+    SIMD_PERF_EXT(n);
+    n->Forward();
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API size_t SimdSynetExternalBufferPlan(const void* const* contexts, const SimdSynetContextType* types, size_t count, SimdBool shared, size_t* offsets)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return Base::SynetExternalBufferPlan(contexts, types, count, shared, offsets);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetSetStrictBuffer(SimdBool strict)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    Base::SynetSetStrictBuffer(strict == SimdTrue);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API SimdBool SimdSynetGetStrictBuffer()
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return Base::SynetGetStrictBuffer() ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 void SimdSynetPoolingAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
     size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format)
 {
@@ -253,6 +253,9 @@ typedef enum
     SimdImageFilePng,
     /*! A JPEG (Joint Photographic Experts Group) image file format. */
     SimdImageFileJpeg,
+    /*! A JPEG (Joint Photographic Experts Group) image file format with optimized (image-specific) Huffman tables.
+        Files are smaller but encoding needs an additional pass over the entropy coded data. */
+    SimdImageFileJpegOptimized,
 } SimdImageFileType;
 
 /*! @ingroup c_types
@@ -402,7 +405,8 @@ typedef enum
 /*! @ingroup synet
     Describes Synet calculation compatibility flags. This type used in functions ::SimdSynetAdd8i, ::SimdSynetScaleLayerForward, 
     ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetScale8iInit,
-    ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetMergedConvolution32fInit, ::SimdSynetMergedConvolution8iInit.
+    ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit, ::SimdSynetInnerProduct32fInit, 
+    ::SimdSynetInnerProduct8iInit, ::SimdSynetMergedConvolution32fInit, ::SimdSynetMergedConvolution8iInit.
 */
 typedef enum
 {
@@ -488,6 +492,20 @@ typedef enum
     SimdTensorData16b, /*!< 16-bit BFloat16 (Brain Floating Point). */
 } SimdTensorDataType;
 
+/*! @ingroup synet
+    Describes type of Synet context. This type is used in function ::SimdSynetExternalBufferPlan.
+*/
+typedef enum
+{
+    SimdSynetContextConvolution32f, /*!< A context created by function ::SimdSynetConvolution32fInit. */
+    SimdSynetContextConvolution8i, /*!< A context created by function ::SimdSynetConvolution8iInit. */
+    SimdSynetContextDeconvolution32f, /*!< A context created by function ::SimdSynetDeconvolution32fInit. */
+    SimdSynetContextInnerProduct32f, /*!< A context created by function ::SimdSynetInnerProduct32fInit. */
+    SimdSynetContextInnerProduct8i, /*!< A context created by function ::SimdSynetInnerProduct8iInit. */
+    SimdSynetContextMergedConvolution32f, /*!< A context created by function ::SimdSynetMergedConvolution32fInit. */
+    SimdSynetContextMergedConvolution8i, /*!< A context created by function ::SimdSynetMergedConvolution8iInit. */
+} SimdSynetContextType;
+
 /*! @ingroup transform
     Describes transform type used in function ::SimdTransformImage in order to describe result of transformation.
 */
@@ -611,6 +629,19 @@ typedef struct SimdConvolutionParameters
     SimdConvolutionActivationType activation;
 } SimdConvolutionParameters;
 
+/*! @ingroup thread
+    Describes a task function which is executed by ::SimdParallelExecute or by user defined executor (see ::SimdSetExecutor).
+    It gets a user context and an index of the task in range [0, number).
+*/
+typedef void(*SimdTaskFuncPtr)(void * context, size_t index);
+
+/*! @ingroup thread
+    Describes user defined executor function (see ::SimdSetExecutor).
+    It has to call function task(context, index) exactly once for every index in range [0, number) and return only after all calls are finished.
+    Calls with different indices may be executed concurrently.
+*/
+typedef void(*SimdExecutorFuncPtr)(void * executor, SimdTaskFuncPtr task, void * context, size_t number);
+
 #if defined(WIN32) && !defined(SIMD_STATIC)
 #  ifdef SIMD_EXPORTS
 #    define SIMD_API __declspec(dllexport)
@@ -756,7 +787,9 @@ extern "C"
 
         \fn size_t SimdGetThreadNumber();
 
-        \short Gets number of threads used by Simd Library to parallelize some algorithms.
+        \short Gets number of threads used by Simd Library to parallelize some algorithms in the calling thread.
+
+        \note It returns the number set by ::SimdSetLocalThreadNumber for the calling thread if it was set, otherwise the global number set by ::SimdSetThreadNumber.
 
         \return current thread number.
     */
@@ -766,12 +799,57 @@ extern "C"
 
         \fn void SimdSetThreadNumber(size_t threadNumber);
 
-        \short Sets number of threads used by Simd Library to parallelize some algorithms.
+        \short Sets global number of threads used by Simd Library to parallelize some algorithms.
+
+        \note This function is thread safe. The global number is used by threads which have no own thread number (see ::SimdSetLocalThreadNumber).
 
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn void SimdSetLocalThreadNumber(size_t threadNumber);
+
+        \short Sets number of threads used by Simd Library to parallelize some algorithms called from the calling thread only.
+
+        It allows to run several independent workloads with different thread budgets in one process.
+
+        \param [in] threadNumber - a number of threads. 0 restores using of global thread number (see ::SimdSetThreadNumber).
+    */
+    SIMD_API void SimdSetLocalThreadNumber(size_t threadNumber);
+
+    /*! @ingroup thread
+
+        \fn void SimdSetExecutor(SimdExecutorFuncPtr executorFunc, void * executor);
+
+        \short Sets user defined executor which is used by Simd Library to run parallel tasks.
+
+        By default Simd Library uses internal pool of persistent worker threads. 
+        The pool has (::SimdGetThreadNumber() - 1) workers (the calling thread also executes tasks). 
+        The workers are created at first parallel call and are recreated after change of thread number. 
+        Idle workers spin for short time and then fall asleep. 
+        This function allows to replace the internal pool by executor of host application (for example its own thread pool).
+
+        \param [in] executorFunc - a pointer to executor function. NULL restores using of internal thread pool.
+        \param [in] executor - a user defined pointer which is passed to executor function.
+    */
+    SIMD_API void SimdSetExecutor(SimdExecutorFuncPtr executorFunc, void * executor);
+
+    /*! @ingroup thread
+
+        \fn void SimdParallelExecute(SimdTaskFuncPtr task, void * context, size_t number);
+
+        \short Executes given number of tasks in parallel with using of current executor (see ::SimdSetExecutor).
+
+        \note Nested calls (from a task) and calls concurrent to other parallel execution are executed in the calling thread.
+
+        \param [in] task - a pointer to task function. It is called exactly once for every index in range [0, number).
+        \param [in] context - a user context which is passed to task function.
+        \param [in] number - a number of tasks.
+    */
+    SIMD_API void SimdParallelExecute(SimdTaskFuncPtr task, void * context, size_t number);
+
     /*! @ingroup cpu_flags
 
         \fn void SimdEmpty();
@@ -3851,6 +3929,9 @@ extern "C"
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
+            For PNG format: if quality is less than 100, filtered image is split into independent blocks which are compressed in parallel
+            (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). Quality 100 means single stream compression.
+            For JPEG format: if thread number is greater than 1, every MCU row of the image is encoded in parallel as a separate restart interval.
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file. 
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3871,6 +3952,9 @@ extern "C"
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
+            For PNG format: if quality is less than 100, filtered image is split into independent blocks which are compressed in parallel
+            (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). Quality 100 means single stream compression.
+            For JPEG format: if thread number is greater than 1, every MCU row of the image is encoded in parallel as a separate restart interval.
         \param [in] path - a path to output image file.
         \return result of the operation.
     */
@@ -3890,6 +3974,8 @@ extern "C"
         \param [in] height - a height of input image. It must be even number.
         \param [in] yuvType - a type of input YUV image(see descriprion of::SimdYuvType). Now only ::SimdYuvTrect871 (T-REC-T.871 format) is supported.
         \param [in] quality - a parameter of compression quality.
+            If thread number is greater than 1, every MCU row of the image is encoded in parallel as a separate restart interval
+            (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3912,6 +3998,8 @@ extern "C"
         \param [in] height - a height of input image. It must be even number.
         \param [in] yuvType - a type of input YUV image(see descriprion of::SimdYuvType). Now only ::SimdYuvTrect871 (T-REC-T.871 format) is supported.
         \param [in] quality - a parameter of compression quality.
+            If thread number is greater than 1, every MCU row of the image is encoded in parallel as a separate restart interval
+            (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3935,6 +4023,8 @@ extern "C"
             Or set ::SimdPixelFormatNone and use pixel format of input image file.
         \return a pointer to pixels data of output image. 
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+
+        \note Decoding of JPEG images supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
     */
     SIMD_API uint8_t* SimdImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
@@ -3953,9 +4043,158 @@ extern "C"
             Or set ::SimdPixelFormatNone and use pixel format of input image file.
         \return a pointer to pixels data of output image.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+
+        \note Decoding of JPEG images supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
     */
     SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from memory buffer with reduced resolution.
+
+        Size of output image is (width + scale - 1) / scale x (height + scale - 1) / scale.
+        JPEG images are downscaled during decoding (reduced IDCT), so it is much faster than full decoding with following resizing.
+        Images of other formats are decoded at full resolution and then resized with area interpolation.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] scale - a scale factor of output image. It can be 1, 2, 4 or 8.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from file with reduced resolution.
+
+        Size of output image is (width + scale - 1) / scale x (height + scale - 1) / scale (See function ::SimdImageLoadFromMemoryScaled).
+
+        \param [in] path - a path to input image file.
+        \param [in] scale - a scale factor of output image. It can be 1, 2, 4 or 8.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads a region of interest of an image from memory buffer.
+
+        For JPEG images only MCUs intersecting with the region (and their neighbors) are reconstructed and color conversion is performed only for pixels of the region. 
+        Decoding of entropy-coded data is stopped below the region, restart intervals which don't intersect with the region are skipped.
+        Images of other formats are decoded at full size and then cropped.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] left - a left side of the region.
+        \param [in] top - a top side of the region.
+        \param [in] right - a right side of the region. It is clipped by image width.
+        \param [in] bottom - a bottom side of the region. It is clipped by image height.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error (or if the region is empty) it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, 
+        size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn void* SimdImageDecoderInit(SimdPixelFormatType format);
+
+        \short Creates context of incremental image decoder.
+
+        Incremental decoder receives image file by parts and gives rows of output image as soon as they are decoded.
+        Baseline JPEG images are decoded by MCU rows. Images of other formats (and progressive JPEG images) are decoded when the whole file is received.
+
+        An using example (decoding of image received by network):
+        \verbatim
+        void * decoder = SimdImageDecoderInit(SimdPixelFormatBgr24);
+        size_t width, height, done = 0;
+        SimdPixelFormatType format;
+        while (ReceiveData(buffer, &size) && SimdImageDecoderPush(decoder, buffer, size))
+        {
+            if (!dst && SimdImageDecoderInfo(decoder, &width, &height, &format))
+                dst = Allocate(width, height, format);
+            if (dst)
+                done += SimdImageDecoderPull(decoder, dst + done * stride, stride, height - done);
+        }
+        SimdRelease(decoder);
+        \endverbatim
+
+        \param [in] format - a pixel format of output image.
+            It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to image decoder context. On error it returns NULL.
+            This pointer is used in functions ::SimdImageDecoderPush, ::SimdImageDecoderInfo and ::SimdImageDecoderPull.
+            It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdImageDecoderInit(SimdPixelFormatType format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageDecoderPush(void* decoder, const uint8_t* data, size_t size);
+
+        \short Passes next part of image file to incremental image decoder.
+
+        \param [in] decoder - an image decoder context. It must be created by function ::SimdImageDecoderInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to next part of image file.
+        \param [in] size - a size of the part in bytes.
+        \return a result of the operation. It returns ::SimdFalse if input data is corrupted or has unsupported format.
+    */
+    SIMD_API SimdBool SimdImageDecoderPush(void* decoder, const uint8_t* data, size_t size);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageDecoderInfo(const void* decoder, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        \short Gets size and pixel format of output image of incremental image decoder.
+
+        \param [in] decoder - an image decoder context. It must be created by function ::SimdImageDecoderInit and released by function ::SimdRelease.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [out] format - a pointer to pixel format of output image.
+        \return ::SimdTrue if the image header has already been decoded, otherwise ::SimdFalse.
+    */
+    SIMD_API SimdBool SimdImageDecoderInfo(const void* decoder, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdImageDecoderPull(void* decoder, uint8_t* dst, size_t stride, size_t rows);
+
+        \short Gets next decoded rows of output image from incremental image decoder.
+
+        \param [in] decoder - an image decoder context. It must be created by function ::SimdImageDecoderInit and released by function ::SimdRelease.
+        \param [out] dst - a pointer to buffer for next rows of output image.
+        \param [in] stride - a row size of the buffer in bytes.
+        \param [in] rows - a maximal number of rows to get.
+        \return a number of rows which have been copied to the buffer.
+    */
+    SIMD_API size_t SimdImageDecoderPull(void* decoder, uint8_t* dst, size_t stride, size_t rows);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -6466,6 +6705,40 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fSetAutotune(SimdBool enable, const char * cache);
+
+        \short Enables or disables empirical autotuning of FP32 convolution algorithm selection.
+
+        By default function ::SimdSynetConvolution32fInit selects convolution algorithm with using of fixed heuristics.
+        If autotuning is enabled, then contexts created by ::SimdSynetConvolution32fInit include all applicable algorithms 
+        and several first calls of ::SimdSynetConvolution32fForward measure execution time of each of them. 
+        After that the fastest algorithm is kept and other ones are released. 
+        The result is stored in the cache (in memory and in the file if it is given) with key which includes CPU model, 
+        thread number and convolution parameters. Contexts created later for the same parameters use the cached algorithm without measurement.
+
+        \note This function does not affect already created contexts. BF16 convolutions are not autotuned.
+
+        \param [in] enable - a flag to enable or disable autotuning.
+        \param [in] cache - a path to the file of autotuning cache. The cache is loaded from this file and new results are appended to it. Can be NULL (cache is kept in memory only).
+    */
+    SIMD_API void SimdSynetConvolution32fSetAutotune(SimdBool enable, const char * cache);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fSetThreadNumber(void * context, size_t threadNumber);
+
+        \short Sets number of threads used by given FP32 convolution context.
+
+        \note It overrides thread number of the calling thread (see ::SimdSetLocalThreadNumber and ::SimdSetThreadNumber) during execution of ::SimdSynetConvolution32fForward.
+            Some algorithms (for example Winograd) allocate per-thread buffers at context creation, so they use not more threads than the thread number at the moment of ::SimdSynetConvolution32fInit.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] threadNumber - a number of threads. 0 (default value) means using of thread number of the calling thread.
+    */
+    SIMD_API void SimdSynetConvolution32fSetThreadNumber(void * context, size_t threadNumber);
+
     /*! @ingroup synet_convolution_fp32
 
         \fn void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
@@ -6479,6 +6752,24 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fForwardBatch(void * context, const float * src, size_t batch, float * buf, float * dst);
+
+        \short Performs forward propagation of FP32 convolution algorithm for given number of images.
+
+        It allows to use one context (with one copy of packed weights) for requests with different batch size.
+        The batch size given in ::SimdSynetConvolution32fInit is a granularity of processing (images are processed by groups of this size). 
+        So the context created with batch size equal to 1 accepts any batch size.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [in] batch - a number of images in input and output tensors. It must be a multiple of batch size given in function ::SimdSynetConvolution32fInit.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetConvolution32fForwardBatch(void * context, const float * src, size_t batch, float * buf, float * dst);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6616,6 +6907,19 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params);
 
+    /*! @ingroup synet_deconvolution_fp32
+
+        \fn void SimdSynetDeconvolution32fSetThreadNumber(void * context, size_t threadNumber);
+
+        \short Sets number of threads used by given FP32 deconvolution context.
+
+        \note It overrides thread number of the calling thread (see ::SimdSetLocalThreadNumber and ::SimdSetThreadNumber) during execution of ::SimdSynetDeconvolution32fForward.
+
+        \param [in, out] context - a pointer to FP32 deconvolution context. It must be created by function ::SimdSynetDeconvolution32fInit and released by function ::SimdRelease.
+        \param [in] threadNumber - a number of threads. 0 (default value) means using of thread number of the calling thread.
+    */
+    SIMD_API void SimdSynetDeconvolution32fSetThreadNumber(void * context, size_t threadNumber);
+
     /*! @ingroup synet_deconvolution_fp32
 
         \fn void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
@@ -6970,7 +7274,7 @@ extern "C"
 
     /*! @ingroup synet_inner_product
 
-        \fn void * SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        \fn void * SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
 
         \short Initilizes FP32 inner product algorithm.
 
@@ -6979,10 +7283,11 @@ extern "C"
         \param [in] output - a output vector size.
         \param [in] transpose - a flag of transposing of weight matrix.
         \param [in] activation - an activation function type used after inner product.
+        \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to FP32 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetInnerProduct32fInternalBufferSize, :SimdSynetInnerProduct32fSetParams and ::SimdSynetInnerProduct32fForward.
     */
-    SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+    SIMD_API void* SimdSynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
 
     /*! @ingroup synet_inner_product
 
@@ -7080,6 +7385,86 @@ extern "C"
     */
     SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t * src, const int8_t * weight, int32_t * dst, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_inner_product
+
+        \fn void * SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+        \short Initilizes INT8 inner product algorithm.
+
+        \param [in] batch - a batch size.
+        \param [in] input - a input vector size.
+        \param [in] output - a output vector size.
+        \param [in] transpose - a flag of transposing of weight matrix.
+        \param [in] srcT - an input tensor data type (::SimdTensorData32f or ::SimdTensorData8u).
+        \param [in] dstT - an output tensor data type (::SimdTensorData32f or ::SimdTensorData8u).
+        \param [in] activation - an activation function type used after inner product.
+        \param [in] compatibility - a flags of calculation compatibility.
+        \return a pointer to INT8 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct8iExternalBufferSize, ::SimdSynetInnerProduct8iInternalBufferSize, 
+            ::SimdSynetInnerProduct8iInfo, ::SimdSynetInnerProduct8iSetParams and ::SimdSynetInnerProduct8iForward.
+    */
+    SIMD_API void* SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+        \short Gets description of internal implementation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of INT8 inner product algorithm.
+    */
+    SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats);
+
+        \short Sets weights, biases, parameters of activation function, input/output tensor statistics required for INT8 inner product algorithm.
+
+        \param [in, out] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) inner product weights.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+    */
+    SIMD_API void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+        \short Performs forward propagation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetInnerProduct8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
@@ -7288,6 +7673,247 @@ extern "C"
     */
     SIMD_API void SimdSynetMish32f(const float* src, size_t size, const float* threshold, float* dst);
 
+
+    /*! @ingroup synet_network
+
+        \fn void * SimdSynetNetworkInit();
+
+        \short Initilizes network context: a sequence of Synet layers which share one memory arena.
+
+        Layers are added in execution order with using of functions ::SimdSynetNetworkAddInput, ::SimdSynetNetworkAddConvolution32f, 
+        ::SimdSynetNetworkAddDeconvolution32f, ::SimdSynetNetworkAddInnerProduct32f, ::SimdSynetNetworkAddMergedConvolution32f, 
+        ::SimdSynetNetworkAddEltwise32f, ::SimdSynetNetworkAddSoftmax32f and ::SimdSynetNetworkAddPooling32f. 
+        Each of these functions returns an index of created tensor. Then function ::SimdSynetNetworkPlan places all intermediate tensors 
+        into one arena (tensors with non-overlapping lifetimes share memory) together with one temporary buffer shared by all layers.
+
+        \return a pointer to network context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in all other SimdSynetNetwork functions.
+    */
+    SIMD_API void* SimdSynetNetworkInit();
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddInput(void * network, size_t size);
+
+        \short Adds input tensor to the network.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] size - a size (in 32-bit float values) of the input tensor.
+        \return an index of the input tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddInput(void* network, size_t size);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddConvolution32f(void * network, void * context, size_t src);
+
+        \short Adds FP32 convolution layer to the network.
+
+        \note The network takes ownership of the convolution context (on success). It must not be released by function ::SimdRelease after that.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 convolution context created by function ::SimdSynetConvolution32fInit. Its parameters must be already set by function ::SimdSynetConvolution32fSetParams.
+        \param [in] src - an index of the input tensor.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddConvolution32f(void* network, void* context, size_t src);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddDeconvolution32f(void * network, void * context, size_t src);
+
+        \short Adds FP32 deconvolution layer to the network.
+
+        \note The network takes ownership of the deconvolution context (on success). It must not be released by function ::SimdRelease after that.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 deconvolution context created by function ::SimdSynetDeconvolution32fInit. Its parameters must be already set by function ::SimdSynetDeconvolution32fSetParams.
+        \param [in] src - an index of the input tensor.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddDeconvolution32f(void* network, void* context, size_t src);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddInnerProduct32f(void * network, void * context, size_t src);
+
+        \short Adds FP32 inner product layer to the network.
+
+        \note The network takes ownership of the inner product context (on success). It must not be released by function ::SimdRelease after that.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 inner product context created by function ::SimdSynetInnerProduct32fInit. Its parameters must be already set by function ::SimdSynetInnerProduct32fSetParams.
+        \param [in] src - an index of the input tensor.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddInnerProduct32f(void* network, void* context, size_t src);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddMergedConvolution32f(void * network, void * context, size_t src);
+
+        \short Adds FP32 merged convolution layer to the network.
+
+        \note The network takes ownership of the merged convolution context (on success). It must not be released by function ::SimdRelease after that.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] context - a pointer to FP32 merged convolution context created by function ::SimdSynetMergedConvolution32fInit. Its parameters must be already set by function ::SimdSynetMergedConvolution32fSetParams.
+        \param [in] src - an index of the input tensor.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddMergedConvolution32f(void* network, void* context, size_t src);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddEltwise32f(void * network, const size_t * src, size_t count, const float * weight, SimdSynetEltwiseOperationType type);
+
+        \short Adds eltwise layer to the network (see function ::SimdSynetEltwiseLayerForward).
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to array with indices of the input tensors. All input tensors must have the same size.
+        \param [in] count - a number of the input tensors. It must be at least 2.
+        \param [in] weight - a pointer to the array with weights (used only for ::SimdSynetEltwiseOperationSum). Can be NULL (all weights are equal to 1).
+        \param [in] type - a type of eltwise operation.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddEltwise32f(void* network, const size_t* src, size_t count, const float* weight, SimdSynetEltwiseOperationType type);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddSoftmax32f(void * network, size_t src, size_t outer, size_t count, size_t inner);
+
+        \short Adds softmax layer to the network (see function ::SimdSynetSoftmaxLayerForward).
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] src - an index of the input tensor. Its size must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input and output tensors.
+        \param [in] count - a size of softmax dimension.
+        \param [in] inner - an inner size of input and output tensors.
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddSoftmax32f(void* network, size_t src, size_t outer, size_t count, size_t inner);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkAddPooling32f(void * network, size_t src, size_t batch, const SimdConvolutionParameters * pooling, SimdBool max, SimdBool excludePad);
+
+        \short Adds pooling layer to the network (see functions ::SimdSynetPoolingMax32f and ::SimdSynetPoolingAverage).
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] src - an index of the input tensor.
+        \param [in] batch - a batch size.
+        \param [in] pooling - a pointer to pooling parameters (sizes, kernel, stride, pad and tensor format; dilation, group and activation are ignored). Input and output channels must be equal.
+        \param [in] max - a type of pooling: max (::SimdTrue) or average (::SimdFalse).
+        \param [in] excludePad - a flag of exclude pad from average value calculation (only for average pooling).
+        \return an index of the output tensor. On error it returns (size_t)-1.
+    */
+    SIMD_API size_t SimdSynetNetworkAddPooling32f(void* network, size_t src, size_t batch, const SimdConvolutionParameters* pooling, SimdBool max, SimdBool excludePad);
+
+    /*! @ingroup synet_network
+
+        \fn SimdBool SimdSynetNetworkPlan(void * network, const size_t * outputs, size_t count);
+
+        \short Plans network memory: places all tensors and shared temporary buffer into one arena with using of tensor liveness analysis.
+
+        \note After this call no layers can be added to the network.
+
+        \param [in, out] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] outputs - a pointer to array with indices of output tensors. They stay valid after the end of ::SimdSynetNetworkForward.
+        \param [in] count - a number of output tensors.
+        \return a result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetNetworkPlan(void* network, const size_t* outputs, size_t count);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetNetworkInternalBufferSize(const void * network);
+
+        \short Gets size in bytes of memory arena used by the network (tensors and shared temporary buffer).
+
+        \param [in] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \return size of memory arena used by the network.
+    */
+    SIMD_API size_t SimdSynetNetworkInternalBufferSize(const void* network);
+
+    /*! @ingroup synet_network
+
+        \fn const char* SimdSynetNetworkInfo(const void* network);
+
+        \short Gets description of the network.
+
+        \param [in] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \return string with description of the network.
+    */
+    SIMD_API const char* SimdSynetNetworkInfo(const void* network);
+
+    /*! @ingroup synet_network
+
+        \fn float * SimdSynetNetworkTensor(void * network, size_t tensor);
+
+        \short Gets pointer to the tensor in network memory arena. 
+
+        It is used to fill input tensors before and to read output tensors after ::SimdSynetNetworkForward. 
+        Intermediate tensors can be overwritten during network execution.
+
+        \param [in] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+        \param [in] tensor - an index of the tensor.
+        \return a pointer to the tensor. It returns NULL if the network is not planned or the index is wrong.
+    */
+    SIMD_API float* SimdSynetNetworkTensor(void* network, size_t tensor);
+
+    /*! @ingroup synet_network
+
+        \fn void SimdSynetNetworkForward(void * network);
+
+        \short Performs forward propagation of all network layers. The network must be planned by function ::SimdSynetNetworkPlan.
+
+        \param [in] network - a pointer to network context. It must be created by function ::SimdSynetNetworkInit and released by function ::SimdRelease.
+    */
+    SIMD_API void SimdSynetNetworkForward(void* network);
+
+    /*! @ingroup synet_network
+
+        \fn size_t SimdSynetExternalBufferPlan(const void * const * contexts, const SimdSynetContextType * types, size_t count, SimdBool shared, size_t * offsets);
+
+        \short Plans one external buffer (scratch arena) for a sequence of Synet contexts.
+
+        Each context gets a region of the arena which can be passed as parameter buf into its Forward function instead of NULL 
+        (in this case the context allocates its own buffer). All regions are aligned (see ::SimdAlignment).
+
+        \param [in] contexts - a pointer to array with Synet contexts.
+        \param [in] types - a pointer to array with types of Synet contexts. 
+        \param [in] count - a number of contexts.
+        \param [in] shared - a flag of sequential execution of the contexts. If it is true, all contexts share the same region of the arena. 
+            Otherwise every context gets its own region (the contexts can be executed concurrently).
+        \param [out] offsets - a pointer to array with offsets (in bytes) of the contexts buffers in the arena. Can be NULL.
+        \return size (in bytes) of the arena.
+    */
+    SIMD_API size_t SimdSynetExternalBufferPlan(const void* const* contexts, const SimdSynetContextType* types, size_t count, SimdBool shared, size_t* offsets);
+
+    /*! @ingroup synet_network
+
+        \fn void SimdSynetSetStrictBuffer(SimdBool strict);
+
+        \short Sets strict mode of using of external buffer by Synet contexts.
+
+        In strict mode Forward functions of Synet contexts must get external buffer (parameter buf) if they need it. 
+        In debug mode they assert instead of allocation of own buffer. So steady-state inference does not allocate memory. 
+        By default strict mode is disabled.
+
+        \param [in] strict - a flag of strict mode.
+    */
+    SIMD_API void SimdSynetSetStrictBuffer(SimdBool strict);
+
+    /*! @ingroup synet_network
+
+        \fn SimdBool SimdSynetGetStrictBuffer();
+
+        \short Gets current strict mode of using of external buffer by Synet contexts (see ::SimdSynetSetStrictBuffer).
+
+        \return current strict mode.
+    */
+    SIMD_API SimdBool SimdSynetGetStrictBuffer();
+
     /*! @ingroup synet_pooling
 
         \fn void SimdSynetPoolingAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, float * dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
@@ -71,7 +71,7 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -80,12 +80,23 @@ namespace Simd
             Array32i hashTable(ZHASH * basket);
             memset(hashTable.data, -1, hashTable.RawSize());
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            int i = Max(begin - 32768, 0), j;
+            for (; i < begin; ++i)
+            {
+                int* hList = hashTable.data + (Base::ZlibHash(data + i) & (ZHASH - 1)) * basket;
+                for (j = 0; j < basket && hList[j] != -1; ++j);
+                if (j == basket)
+                {
+                    memcpy(hList, hList + quality, quality * sizeof(int));
+                    memset(hList + quality, -1, quality * sizeof(int));
+                    j = quality;
+                }
+                hList[j] = i;
+            }
+
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
 
-            int i = 0, j;
             while (i < size - 3)
             {
                 int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
@@ -152,7 +163,16 @@ namespace Simd
             for (; i < size; ++i)
                 Base::ZlibHuffB(data[i], stream);
             Base::ZlibHuff(256, stream);
+            if (!last)
+                Base::ZlibSyncFlush(stream);
             stream.FlushBits();
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            ZlibDeflate(data, 0, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -403,6 +423,8 @@ namespace Simd
             _encode[5] = Neon::EncodeLine5;
             _encode[6] = Neon::EncodeLine6;
             _compress = Neon::ZlibCompress;
+            _deflate = Neon::ZlibDeflate;
+            _adler32 = Neon::ZlibAdler32;
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -216,12 +216,14 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation)
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
         {
-            InnerProductParam32f param(batch, input, output, transpose, activation);
+            InnerProductParam32f param(batch, input, output, transpose, activation, compatibility);
             if (!param.Valid())
                 return NULL;
-            if (SynetInnerProduct32fProd::Preferable(param) && 0)
+            if (Base::Bf16Soft(compatibility))
+                return new Base::SynetInnerProduct32fBf16(param, Neon::SynetConvolution32fInit);
+            else if (SynetInnerProduct32fProd::Preferable(param) && 0)
                 return new SynetInnerProduct32fProd(param);
             else
                 return new SynetInnerProduct32fGemm(param);
@@ -21,46 +21,48 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
-#ifndef __SimdParallel_hpp__
-#define __SimdParallel_hpp__
-
-#include <vector>
-#include <thread>
-#ifndef SIMD_FUTURE_DISABLE
-#include <future>
-#endif
-
-namespace Simd
-{
-    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
-    {
-#ifdef SIMD_FUTURE_DISABLE
-        function(0, begin, end);
-#else
-        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
-        if (threadNumber <= 1 || size_t(blockAlign*1.5) >= (end - begin))
-            function(0, begin, end);
-        else
-        {
-            std::vector<std::future<void>> futures;
-
-            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
-            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
-            {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
-        }
-#endif
-    }
-}
-
-#endif//__SimdParallel_hpp__
+#ifndef __SimdParallel_hpp__
+#define __SimdParallel_hpp__
+
+#include "Simd/SimdLib.h"
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+namespace Simd
+{
+    template<class Function> struct ParallelTask
+    {
+        const Function & function;
+        size_t begin, end, blockSize;
+
+        static void Run(void * context, size_t index)
+        {
+            const ParallelTask * task = (const ParallelTask*)context;
+            size_t blockBegin = task->begin + index * task->blockSize;
+            size_t blockEnd = std::min(blockBegin + task->blockSize, task->end);
+            task->function(index, blockBegin, blockEnd);
+        }
+    };
+
+    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
+    {
+#ifdef SIMD_FUTURE_DISABLE
+        function(0, begin, end);
+#else
+        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+        if (threadNumber <= 1 || size_t(blockAlign*1.5) >= (end - begin))
+            function(0, begin, end);
+        else
+        {
+            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
+            ParallelTask<Function> task = { function, begin, end, blockSize };
+            SimdParallelExecute(ParallelTask<Function>::Run, &task, (end - begin + blockSize - 1) / blockSize);
+        }
+#endif
+    }
+}
+
+#endif//__SimdParallel_hpp__
@@ -100,6 +100,11 @@ namespace Simd
             return _candidates[index].func;
         }
 
+        SIMD_INLINE const Func * Selected() const
+        {
+            return _best;
+        }
+
     private:
         static const size_t TEST_COUNT = 3 + 2;
 
@@ -154,6 +154,45 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Downscale())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        uint8_t* ImageLoadFromMemoryRegion(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            param.left = left;
+            param.top = top;
+            param.right = right;
+            param.bottom = bottom;
+            if (param.Region() && param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream() && loader->Crop())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        void* ImageDecoderInit(SimdPixelFormatType format)
+        {
+            return new ImageDecoder(format, CreateImageLoader);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
@@ -89,6 +90,8 @@ namespace Simd
 
             png_uc* img_buffer, * img_buffer_end;
             png_uc* img_buffer_original, * img_buffer_original_end;
+
+            Base::Zlib::Adler32Ptr adler32;
         } png__context;
 
         typedef struct
@@ -373,503 +376,16 @@ namespace Simd
             return good;
         }
 
-        // fast-way is faster to check than jpeg huffman, but slow way is slower
-#define PNG__ZFAST_BITS  9 // accelerate all cases in default tables
-#define PNG__ZFAST_MASK  ((1 << PNG__ZFAST_BITS) - 1)
-
-// zlib-style huffman encoding
-// (jpegs packs from left, zlib from right, so can't share code)
-        typedef struct
-        {
-            png__uint16 fast[1 << PNG__ZFAST_BITS];
-            png__uint16 firstcode[16];
-            int maxcode[17];
-            png__uint16 firstsymbol[16];
-            png_uc  size[288];
-            png__uint16 value[288];
-        } png__zhuffman;
-
-        png_inline static int png__bitreverse16(int n)
-        {
-            n = ((n & 0xAAAA) >> 1) | ((n & 0x5555) << 1);
-            n = ((n & 0xCCCC) >> 2) | ((n & 0x3333) << 2);
-            n = ((n & 0xF0F0) >> 4) | ((n & 0x0F0F) << 4);
-            n = ((n & 0xFF00) >> 8) | ((n & 0x00FF) << 8);
-            return n;
-        }
-
-        png_inline static int png__bit_reverse(int v, int bits)
-        {
-            PNG_ASSERT(bits <= 16);
-            // to bit reverse n bits, reverse 16 and shift
-            // e.g. 11 bits, bit reverse and shift away 5
-            return png__bitreverse16(v) >> (16 - bits);
-        }
-
-        static int png__zbuild_huffman(png__zhuffman* z, const png_uc* sizelist, int num)
-        {
-            int i, k = 0;
-            int code, next_code[16], sizes[17];
-
-            // DEFLATE spec for generating codes
-            memset(sizes, 0, sizeof(sizes));
-            memset(z->fast, 0, sizeof(z->fast));
-            for (i = 0; i < num; ++i)
-                ++sizes[sizelist[i]];
-            sizes[0] = 0;
-            for (i = 1; i < 16; ++i)
-                if (sizes[i] > (1 << i))
-                    return png__err("bad sizes", "Corrupt PNG");
-            code = 0;
-            for (i = 1; i < 16; ++i) {
-                next_code[i] = code;
-                z->firstcode[i] = (png__uint16)code;
-                z->firstsymbol[i] = (png__uint16)k;
-                code = (code + sizes[i]);
-                if (sizes[i])
-                    if (code - 1 >= (1 << i)) return png__err("bad codelengths", "Corrupt PNG");
-                z->maxcode[i] = code << (16 - i); // preshift for inner loop
-                code <<= 1;
-                k += sizes[i];
-            }
-            z->maxcode[16] = 0x10000; // sentinel
-            for (i = 0; i < num; ++i) {
-                int s = sizelist[i];
-                if (s) {
-                    int c = next_code[s] - z->firstcode[s] + z->firstsymbol[s];
-                    png__uint16 fastv = (png__uint16)((s << 9) | i);
-                    z->size[c] = (png_uc)s;
-                    z->value[c] = (png__uint16)i;
-                    if (s <= PNG__ZFAST_BITS) {
-                        int j = png__bit_reverse(next_code[s], s);
-                        while (j < (1 << PNG__ZFAST_BITS)) {
-                            z->fast[j] = fastv;
-                            j += (1 << s);
-                        }
-                    }
-                    ++next_code[s];
-                }
-            }
-            return 1;
-        }
-
-        // zlib-from-memory implementation for PNG reading
-        //    because PNG allows splitting the zlib stream arbitrarily,
-        //    and it's annoying structurally to have PNG call ZLIB call PNG,
-        //    we require PNG read all the IDATs and combine them into a single
-        //    memory buffer
-
-        typedef struct
-        {
-            png_uc* zbuffer, * zbuffer_end;
-            int num_bits;
-            png__uint32 code_buffer;
-
-            char* zout;
-            char* zout_start;
-            char* zout_end;
-            int   z_expandable;
-
-            png__zhuffman z_length, z_distance;
-        } png__zbuf;
-
-        png_inline static int png__zeof(png__zbuf* z)
-        {
-            return (z->zbuffer >= z->zbuffer_end);
-        }
-
-        png_inline static png_uc png__zget8(png__zbuf* z)
-        {
-            return png__zeof(z) ? 0 : *z->zbuffer++;
-        }
-
-        static void png__fill_bits(png__zbuf* z)
-        {
-            do {
-                if (z->code_buffer >= (1U << z->num_bits)) {
-                    z->zbuffer = z->zbuffer_end;  /* treat this as EOF so we fail. */
-                    return;
-                }
-                z->code_buffer |= (unsigned int)png__zget8(z) << z->num_bits;
-                z->num_bits += 8;
-            } while (z->num_bits <= 24);
-        }
-
-        png_inline static unsigned int png__zreceive(png__zbuf* z, int n)
-        {
-            unsigned int k;
-            if (z->num_bits < n) png__fill_bits(z);
-            k = z->code_buffer & ((1 << n) - 1);
-            z->code_buffer >>= n;
-            z->num_bits -= n;
-            return k;
-        }
-
-        static int png__zhuffman_decode_slowpath(png__zbuf* a, png__zhuffman* z)
-        {
-            int b, s, k;
-            // not resolved by fast table, so compute it the slow way
-            // use jpeg approach, which requires MSbits at top
-            k = png__bit_reverse(a->code_buffer, 16);
-            for (s = PNG__ZFAST_BITS + 1; ; ++s)
-                if (k < z->maxcode[s])
-                    break;
-            if (s >= 16) return -1; // invalid code!
-            // code size is s, so:
-            b = (k >> (16 - s)) - z->firstcode[s] + z->firstsymbol[s];
-            if (b >= sizeof(z->size)) return -1; // some data was corrupt somewhere!
-            if (z->size[b] != s) return -1;  // was originally an assert, but report failure instead.
-            a->code_buffer >>= s;
-            a->num_bits -= s;
-            return z->value[b];
-        }
-
-        png_inline static int png__zhuffman_decode(png__zbuf* a, png__zhuffman* z)
+        static png_uc* png__zlib_decode(const png_uc* data, int size, int guess, int* outlen, int parse_header, Base::Zlib::Adler32Ptr adler32)
         {
-            int b, s;
-            if (a->num_bits < 16) {
-                if (png__zeof(a)) {
-                    return -1;   /* report error for unexpected end of data. */
-                }
-                png__fill_bits(a);
-            }
-            b = z->fast[a->code_buffer & PNG__ZFAST_MASK];
-            if (b) {
-                s = b >> 9;
-                a->code_buffer >>= s;
-                a->num_bits -= s;
-                return b & 511;
-            }
-            return png__zhuffman_decode_slowpath(a, z);
-        }
-
-        static int png__zexpand(png__zbuf* z, char* zout, int n)  // need to make room for n bytes
-        {
-            char* q;
-            unsigned int cur, limit, old_limit;
-            z->zout = zout;
-            if (!z->z_expandable) return png__err("output buffer limit", "Corrupt PNG");
-            cur = (unsigned int)(z->zout - z->zout_start);
-            limit = old_limit = (unsigned)(z->zout_end - z->zout_start);
-            if (UINT_MAX - cur < (unsigned)n) return png__err("outofmem", "Out of memory");
-            while (cur + n > limit) {
-                if (limit > UINT_MAX / 2) return png__err("outofmem", "Out of memory");
-                limit *= 2;
-            }
-            q = (char*)PNG_REALLOC_SIZED(z->zout_start, old_limit, limit);
-            PNG_NOTUSED(old_limit);
-            if (q == NULL) return png__err("outofmem", "Out of memory");
-            z->zout_start = q;
-            z->zout = q + cur;
-            z->zout_end = q + limit;
-            return 1;
-        }
-
-        static const int png__zlength_base[31] = {
-           3,4,5,6,7,8,9,10,11,13,
-           15,17,19,23,27,31,35,43,51,59,
-           67,83,99,115,131,163,195,227,258,0,0 };
-
-        static const int png__zlength_extra[31] =
-        { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0,0,0 };
-
-        static const int png__zdist_base[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
-        257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0 };
-
-        static const int png__zdist_extra[32] =
-        { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
-
-        static int png__parse_huffman_block(png__zbuf* a)
-        {
-            SIMD_PERF_FUNC();
-
-            char* zout = a->zout;
-            for (;;) {
-                int z = png__zhuffman_decode(a, &a->z_length);
-                if (z < 256) {
-                    if (z < 0) return png__err("bad huffman code", "Corrupt PNG"); // error in huffman codes
-                    if (zout >= a->zout_end) {
-                        if (!png__zexpand(a, zout, 1)) return 0;
-                        zout = a->zout;
-                    }
-                    *zout++ = (char)z;
-                }
-                else {
-                    png_uc* p;
-                    int len, dist;
-                    if (z == 256) {
-                        a->zout = zout;
-                        return 1;
-                    }
-                    z -= 257;
-                    len = png__zlength_base[z];
-                    if (png__zlength_extra[z]) len += png__zreceive(a, png__zlength_extra[z]);
-                    z = png__zhuffman_decode(a, &a->z_distance);
-                    if (z < 0) return png__err("bad huffman code", "Corrupt PNG");
-                    dist = png__zdist_base[z];
-                    if (png__zdist_extra[z]) dist += png__zreceive(a, png__zdist_extra[z]);
-                    if (zout - a->zout_start < dist) return png__err("bad dist", "Corrupt PNG");
-                    if (zout + len > a->zout_end) {
-                        if (!png__zexpand(a, zout, len)) return 0;
-                        zout = a->zout;
-                    }
-                    p = (png_uc*)(zout - dist);
-                    if (dist == 1) { // run of one byte; common in images.
-                        png_uc v = *p;
-                        if (len) { do *zout++ = v; while (--len); }
-                    }
-                    else {
-                        if (len) { do *zout++ = *p++; while (--len); }
-                    }
-                }
-            }
-        }
-
-        static int png__compute_huffman_codes(png__zbuf* a)
-        {
-            static const png_uc length_dezigzag[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
-            png__zhuffman z_codelength;
-            png_uc lencodes[286 + 32 + 137];//padding for maximum single op
-            png_uc codelength_sizes[19];
-            int i, n;
-
-            int hlit = png__zreceive(a, 5) + 257;
-            int hdist = png__zreceive(a, 5) + 1;
-            int hclen = png__zreceive(a, 4) + 4;
-            int ntot = hlit + hdist;
-
-            memset(codelength_sizes, 0, sizeof(codelength_sizes));
-            for (i = 0; i < hclen; ++i) {
-                int s = png__zreceive(a, 3);
-                codelength_sizes[length_dezigzag[i]] = (png_uc)s;
-            }
-            if (!png__zbuild_huffman(&z_codelength, codelength_sizes, 19)) return 0;
-
-            n = 0;
-            while (n < ntot) {
-                int c = png__zhuffman_decode(a, &z_codelength);
-                if (c < 0 || c >= 19) return png__err("bad codelengths", "Corrupt PNG");
-                if (c < 16)
-                    lencodes[n++] = (png_uc)c;
-                else {
-                    png_uc fill = 0;
-                    if (c == 16) {
-                        c = png__zreceive(a, 2) + 3;
-                        if (n == 0) return png__err("bad codelengths", "Corrupt PNG");
-                        fill = lencodes[n - 1];
-                    }
-                    else if (c == 17) {
-                        c = png__zreceive(a, 3) + 3;
-                    }
-                    else if (c == 18) {
-                        c = png__zreceive(a, 7) + 11;
-                    }
-                    else {
-                        return png__err("bad codelengths", "Corrupt PNG");
-                    }
-                    if (ntot - n < c) return png__err("bad codelengths", "Corrupt PNG");
-                    memset(lencodes + n, fill, c);
-                    n += c;
-                }
-            }
-            if (n != ntot) return png__err("bad codelengths", "Corrupt PNG");
-            if (!png__zbuild_huffman(&a->z_length, lencodes, hlit)) return 0;
-            if (!png__zbuild_huffman(&a->z_distance, lencodes + hlit, hdist)) return 0;
-            return 1;
-        }
-
-        static int png__parse_uncompressed_block(png__zbuf* a)
-        {
-            png_uc header[4];
-            int len, nlen, k;
-            if (a->num_bits & 7)
-                png__zreceive(a, a->num_bits & 7); // discard
-             // drain the bit-packed data into header
-            k = 0;
-            while (a->num_bits > 0) {
-                header[k++] = (png_uc)(a->code_buffer & 255); // suppress MSVC run-time check
-                a->code_buffer >>= 8;
-                a->num_bits -= 8;
-            }
-            if (a->num_bits < 0) return png__err("zlib corrupt", "Corrupt PNG");
-            // now fill header the normal way
-            while (k < 4)
-                header[k++] = png__zget8(a);
-            len = header[1] * 256 + header[0];
-            nlen = header[3] * 256 + header[2];
-            if (nlen != (len ^ 0xffff)) return png__err("zlib corrupt", "Corrupt PNG");
-            if (a->zbuffer + len > a->zbuffer_end) return png__err("read past buffer", "Corrupt PNG");
-            if (a->zout + len > a->zout_end)
-                if (!png__zexpand(a, a->zout, len)) return 0;
-            memcpy(a->zout, a->zbuffer, len);
-            a->zbuffer += len;
-            a->zout += len;
-            return 1;
-        }
-
-        static int png__parse_zlib_header(png__zbuf* a)
-        {
-            int cmf = png__zget8(a);
-            int cm = cmf & 15;
-            /* int cinfo = cmf >> 4; */
-            int flg = png__zget8(a);
-            if (png__zeof(a)) return png__err("bad zlib header", "Corrupt PNG"); // zlib spec
-            if ((cmf * 256 + flg) % 31 != 0) return png__err("bad zlib header", "Corrupt PNG"); // zlib spec
-            if (flg & 32) return png__err("no preset dict", "Corrupt PNG"); // preset dictionary not allowed in png
-            if (cm != 8) return png__err("bad compression", "Corrupt PNG"); // DEFLATE required for png
-            // window = 1 << (8 + cinfo)... but who cares, we fully buffer output
-            return 1;
-        }
-
-        static const png_uc png__zdefault_length[288] =
-        {
-           8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-           8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-           8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-           8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-           8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-           9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-           9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-           9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
-           7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, 7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8
-        };
-        static const png_uc png__zdefault_distance[32] =
-        {
-           5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-        };
-        /*
-        Init algorithm:
-        {
-           int i;   // use <= to match clearly with spec
-           for (i=0; i <= 143; ++i)     png__zdefault_length[i]   = 8;
-           for (   ; i <= 255; ++i)     png__zdefault_length[i]   = 9;
-           for (   ; i <= 279; ++i)     png__zdefault_length[i]   = 7;
-           for (   ; i <= 287; ++i)     png__zdefault_length[i]   = 8;
-
-           for (i=0; i <=  31; ++i)     png__zdefault_distance[i] = 5;
-        }
-        */
-
-        static int png__parse_zlib(png__zbuf* a, int parse_header)
-        {
-            int final, type;
-            if (parse_header)
-                if (!png__parse_zlib_header(a)) return 0;
-            a->num_bits = 0;
-            a->code_buffer = 0;
-            do {
-                final = png__zreceive(a, 1);
-                type = png__zreceive(a, 2);
-                if (type == 0) {
-                    if (!png__parse_uncompressed_block(a)) return 0;
-                }
-                else if (type == 3) {
-                    return 0;
-                }
-                else {
-                    if (type == 1) {
-                        // use fixed code lengths
-                        if (!png__zbuild_huffman(&a->z_length, png__zdefault_length, 288)) return 0;
-                        if (!png__zbuild_huffman(&a->z_distance, png__zdefault_distance, 32)) return 0;
-                    }
-                    else {
-                        if (!png__compute_huffman_codes(a)) return 0;
-                    }
-                    if (!png__parse_huffman_block(a)) return 0;
-                }
-            } while (!final);
-            return 1;
-        }
-
-        static int png__do_zlib(png__zbuf* a, char* obuf, int olen, int exp, int parse_header)
-        {
-            a->zout_start = obuf;
-            a->zout = obuf;
-            a->zout_end = obuf + olen;
-            a->z_expandable = exp;
-
-            return png__parse_zlib(a, parse_header);
-        }
-
-        STBIDEF char* png_zlib_decode_malloc_guesssize(const char* buffer, int len, int initial_size, int* outlen)
-        {
-            png__zbuf a;
-            char* p = (char*)png__malloc(initial_size);
-            if (p == NULL) return NULL;
-            a.zbuffer = (png_uc*)buffer;
-            a.zbuffer_end = (png_uc*)buffer + len;
-            if (png__do_zlib(&a, p, initial_size, 1, 1)) {
-                if (outlen) *outlen = (int)(a.zout - a.zout_start);
-                return a.zout_start;
-            }
-            else {
-                PNG_FREE(a.zout_start);
-                return NULL;
-            }
-        }
-
-        STBIDEF char* png_zlib_decode_malloc(char const* buffer, int len, int* outlen)
-        {
-            return png_zlib_decode_malloc_guesssize(buffer, len, 16384, outlen);
-        }
-
-        STBIDEF char* png_zlib_decode_malloc_guesssize_headerflag(const char* buffer, int len, int initial_size, int* outlen, int parse_header)
-        {
-            png__zbuf a;
-            char* p = (char*)png__malloc(initial_size);
-            if (p == NULL) return NULL;
-            a.zbuffer = (png_uc*)buffer;
-            a.zbuffer_end = (png_uc*)buffer + len;
-            if (png__do_zlib(&a, p, initial_size, 1, parse_header)) {
-                if (outlen) *outlen = (int)(a.zout - a.zout_start);
-                return a.zout_start;
-            }
-            else {
-                PNG_FREE(a.zout_start);
-                return NULL;
-            }
-        }
-
-        STBIDEF int png_zlib_decode_buffer(char* obuffer, int olen, char const* ibuffer, int ilen)
-        {
-            png__zbuf a;
-            a.zbuffer = (png_uc*)ibuffer;
-            a.zbuffer_end = (png_uc*)ibuffer + ilen;
-            if (png__do_zlib(&a, obuffer, olen, 0, 1))
-                return (int)(a.zout - a.zout_start);
-            else
-                return -1;
-        }
-
-        STBIDEF char* png_zlib_decode_noheader_malloc(char const* buffer, int len, int* outlen)
-        {
-            png__zbuf a;
-            char* p = (char*)png__malloc(16384);
-            if (p == NULL) return NULL;
-            a.zbuffer = (png_uc*)buffer;
-            a.zbuffer_end = (png_uc*)buffer + len;
-            if (png__do_zlib(&a, p, 16384, 1, 0)) {
-                if (outlen) *outlen = (int)(a.zout - a.zout_start);
-                return a.zout_start;
-            }
-            else {
-                PNG_FREE(a.zout_start);
+            InputMemoryStream src(data, size);
+            OutputMemoryStream dst(guess);
+            if (!Base::Zlib::Decode(src, dst, parse_header != 0, adler32))
                 return NULL;
-            }
+            *outlen = (int)dst.Size();
+            return dst.Release();
         }
 
-        STBIDEF int png_zlib_decode_noheader_buffer(char* obuffer, int olen, const char* ibuffer, int ilen)
-        {
-            png__zbuf a;
-            a.zbuffer = (png_uc*)ibuffer;
-            a.zbuffer_end = (png_uc*)ibuffer + ilen;
-            if (png__do_zlib(&a, obuffer, olen, 0, 0))
-                return (int)(a.zout - a.zout_start);
-            else
-                return -1;
-        }
-
-
         // public domain "baseline" PNG decoder   v0.10  Sean Barrett 2006-11-18
         //    simple implementation
         //      - only 8-bit samples
@@ -1482,7 +998,7 @@ namespace Simd
                     // initial guess for decoded data size to avoid unnecessary reallocs
                     bpl = (s->img_x * z->depth + 7) / 8; // bytes per line, per component
                     raw_len = bpl * s->img_y * s->img_n /* pixels */ + s->img_y /* filter mode per row */;
-                    z->expanded = (png_uc*)png_zlib_decode_malloc_guesssize_headerflag((char*)z->idata, ioff, raw_len, (int*)&raw_len, !is_iphone);
+                    z->expanded = png__zlib_decode(z->idata, ioff, raw_len, (int*)&raw_len, !is_iphone, s->adler32);
                     if (z->expanded == NULL) return 0; // zlib should set error
                     PNG_FREE(z->idata); z->idata = NULL;
                     if ((req_comp == s->img_n + 1 && req_comp != 3 && !pal_img_n) || has_trans)
@@ -1512,7 +1028,7 @@ namespace Simd
                         // non-paletted image with tRNS -> source image has (constant) alpha
                         ++s->img_n;
                     }
-                    PNG_FREE(z->expanded); z->expanded = NULL;
+                    Simd::Free(z->expanded); z->expanded = NULL;
                     // end of PNG chunk, read and skip CRC
                     png__get32be(s);
                     return 1;
@@ -1566,7 +1082,7 @@ namespace Simd
                 if (n) *n = p->s->img_n;
             }
             PNG_FREE(p->out);      p->out = NULL;
-            PNG_FREE(p->expanded); p->expanded = NULL;
+            Simd::Free(p->expanded); p->expanded = NULL;
             PNG_FREE(p->idata);    p->idata = NULL;
 
             return result;
@@ -1717,6 +1233,7 @@ namespace Simd
         {
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgb24;
+            _adler32 = Sse41::ZlibAdler32;
         }
 
         bool ImagePngLoader::FromStream()
@@ -1732,6 +1249,7 @@ namespace Simd
             s.read_from_callbacks = 1;
             s.callback_already_read = 0;
             s.img_buffer = s.img_buffer_original = s.buffer_start;
+            s.adler32 = _adler32;
             png__refill_buffer(&s);
             s.img_buffer_original_end = s.img_buffer_end;
             png__result_info ri;
@@ -36,35 +36,38 @@ namespace Simd
     {
         uint32_t ZlibAdler32(uint8_t* data, int size)
         {
-            __m128i _i0 = _mm_setr_epi32(0, -1, -2, -3), _4 = _mm_set1_epi32(4);
+            const int BLOCK = 32, NMAX = 5552 / BLOCK * BLOCK;
+            const __m128i K0 = SIMD_MM_SETR_EPI8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+            const __m128i K1 = SIMD_MM_SETR_EPI8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
             uint32_t lo = 1, hi = 0;
-            for (int b = 0, n = (int)(size % 5552); b < size;)
+            int i = 0, sizeA = size & (~(BLOCK - 1));
+            while (i < sizeA)
             {
-                int n4 = n & (~3), i = 0;
-                __m128i _i = _mm_add_epi32(_i0, _mm_set1_epi32(n));
-                __m128i _l = _mm_setzero_si128(), _h = _mm_setzero_si128();
-                for (; i < n4; i += 4)
+                int n = Min(sizeA - i, NMAX);
+                __m128i s1 = _mm_setzero_si128(), s2 = _mm_setzero_si128(), ps = _mm_setzero_si128();
+                for (int end = i + n; i < end; i += BLOCK)
                 {
-                    __m128i d = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(data + b + i)));
-                    _l = _mm_add_epi32(_l, d);
-                    _h = _mm_add_epi32(_h, _mm_mullo_epi32(d, _i));
-                    _i = _mm_sub_epi32(_i, _4);
+                    __m128i d0 = _mm_loadu_si128((__m128i*)(data + i + 0));
+                    __m128i d1 = _mm_loadu_si128((__m128i*)(data + i + A));
+                    ps = _mm_add_epi32(ps, s1);
+                    s1 = _mm_add_epi32(s1, _mm_sad_epu8(d0, K_ZERO));
+                    s2 = _mm_add_epi32(s2, _mm_madd_epi16(_mm_maddubs_epi16(d0, K0), K16_0001));
+                    s1 = _mm_add_epi32(s1, _mm_sad_epu8(d1, K_ZERO));
+                    s2 = _mm_add_epi32(s2, _mm_madd_epi16(_mm_maddubs_epi16(d1, K1), K16_0001));
                 }
-                int l = ExtractInt32Sum(_l), h = ExtractInt32Sum(_h);
-                for (; i < n; ++i)
-                {
-                    l += data[b + i];
-                    h += data[b + i]*(n - i);
-                }
-                hi = (hi + h + lo*n) % 65521;
-                lo = (lo + l) % 65521;
-                b += n;
-                n = 5552;
+                s2 = _mm_add_epi32(s2, _mm_slli_epi32(ps, 5));
+                hi = (hi + lo * n + ExtractInt32Sum(s2)) % 65521;
+                lo = (lo + ExtractInt32Sum(s1)) % 65521;
+            }
+            for (; i < size; ++i)
+            {
+                lo += data[i];
+                hi += lo;
             }
-            return (hi << 16) | lo;
+            return ((hi % 65521) << 16) | (lo % 65521);
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibDeflate(uint8_t* data, int begin, int size, int quality, bool last, OutputMemoryStream& stream)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -73,12 +76,23 @@ namespace Simd
             Array32i hashTable(ZHASH * basket);
             memset(hashTable.data, -1, hashTable.RawSize());
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
+            int i = Max(begin - 32768, 0), j;
+            for (; i < begin; ++i)
+            {
+                int* hList = hashTable.data + (Base::ZlibHash(data + i) & (ZHASH - 1)) * basket;
+                for (j = 0; j < basket && hList[j] != -1; ++j);
+                if (j == basket)
+                {
+                    memcpy(hList, hList + quality, quality * sizeof(int));
+                    memset(hList + quality, -1, quality * sizeof(int));
+                    j = quality;
+                }
+                hList[j] = i;
+            }
+
+            stream.WriteBits(last ? 1 : 0, 1);
             stream.WriteBits(1, 2);
 
-            int i = 0, j;
             while (i < size - 3)
             {
                 int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
@@ -145,7 +159,16 @@ namespace Simd
             for (; i < size; ++i)
                 Base::ZlibHuffB(data[i], stream);
             Base::ZlibHuff(256, stream);
+            if (!last)
+                Base::ZlibSyncFlush(stream);
             stream.FlushBits();
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            ZlibDeflate(data, 0, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -365,6 +388,8 @@ namespace Simd
             _encode[5] = Sse41::EncodeLine5;
             _encode[6] = Sse41::EncodeLine6;
             _compress = Sse41::ZlibCompress;
+            _deflate = Sse41::ZlibDeflate;
+            _adler32 = Sse41::ZlibAdler32;
         }
     }
 #endif// SIMD_SSE41_ENABLE
@@ -220,6 +220,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _threadNumber(0)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -255,12 +256,15 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        void ForwardBatch(const float * src, size_t batch, float * buf, float * dst);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
                 return buffer;
             else
             {
+                assert(ExternalBufferSize() == 0 || !Base::SynetGetStrictBuffer());
                 _buffer.Resize(ExternalBufferSize());
                 return _buffer.data;
             }
@@ -276,6 +280,16 @@ namespace Simd
             return _info.c_str();
         }
 
+        size_t ThreadNumber() const
+        {
+            return _threadNumber;
+        }
+
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = threadNumber;
+        }
+
     protected:
         typedef void(*NhwcReorderB)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
@@ -291,6 +305,7 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        size_t _threadNumber;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -303,6 +318,8 @@ namespace Simd
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        size_t SynetConvolution32fThreadNumber(const ConvParam32f & p);
+
         class SynetConvolution32fGemmNN : public SynetConvolution32f
         {
         public:
@@ -360,6 +377,7 @@ namespace Simd
             void SetBlock(size_t blockY, size_t blockX);
             void ForwardMerged(const float * src, float * bufS, float * bufD, float * dst);
             void ForwardSplitted(const float * src, float * bufS, float * bufD, float * dst);
+            void ForwardSplitted(const float * src, size_t split, float * bufS, float * bufD, float * dst);
 #ifdef SIMD_PERFORMANCE_STATISTIC
             long long RealFlop() const
             {
@@ -367,7 +385,7 @@ namespace Simd
                 return p.batch * _count * p.srcC * _tileH * _tileW * p.dstC * 2 ;
             }
 #endif
-            size_t _count, _blockY, _blockX, _tileH, _tileW, _strideW, _strideS, _strideD, _M, _N, _K, _batch, _sizeS, _sizeD, _nhwcStrideW, _merge, _split, _tileHs;
+            size_t _count, _blockY, _blockX, _tileH, _tileW, _strideW, _strideS, _strideD, _M, _N, _K, _batch, _sizeS, _sizeD, _nhwcStrideW, _merge, _split, _tileHs, _threads;
             Array32f _winogradWeight;
             SetFilter _setFilter;
             SetInput _setInput;
@@ -409,6 +427,8 @@ namespace Simd
         protected:
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(); 
 
+            void ForwardRows(const float * src, size_t yBeg, size_t yEnd, float * dst);
+
             size_t _batch, _sizeS, _sizeD;
             ConvolutionBiasActivationPtr _convolutionBiasActivation;
         };
@@ -458,6 +478,8 @@ namespace Simd
             Array32f _rWeight, _rBias, _rParams;
 
             static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, size_t dcBeg, size_t dcEnd, size_t yBeg, size_t yEnd, 
+                const float* weight, const float* bias, const float* params, float* dst);
 
             struct RunArgs
             {
@@ -577,6 +599,106 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        void SynetConvolution32fSetAutotune(SimdBool enable, const char * cache);
+
+        bool SynetConvolution32fAutotuneEnable();
+
+        String SynetConvolution32fAutotuneKey(const ConvParam32f & p);
+
+        bool SynetConvolution32fAutotuneLoad(const String & key, String & desc);
+
+        void SynetConvolution32fAutotuneSave(const String & key, const String & desc);
+
+        typedef std::vector<SynetConvolution32f*> SynetConvolution32fPtrs;
+
+        class SynetConvolution32fAutotune : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fAutotune(const ConvParam32f & p, const SynetConvolution32fPtrs & engines, const String & key);
+            virtual ~SynetConvolution32fAutotune();
+            virtual String Ext() const { return _engines[0]->Ext(); }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+
+        protected:
+            struct Args
+            {
+                const float * src; float * buf; float * dst;
+                SIMD_INLINE Args(const float * src_, float * buf_, float * dst_)
+                    : src(src_), buf(buf_), dst(dst_)
+                {}
+            };
+
+            struct Func
+            {
+                SIMD_INLINE Func(SynetConvolution32f * engine)
+                    : _engine(engine)
+                    , _name(engine->Desc())
+                {
+                }
+
+                SIMD_INLINE String Name() const { return _name; }
+
+                SIMD_INLINE SynetConvolution32f * Engine() const { return _engine; }
+
+                SIMD_INLINE void Run(const Args & args)
+                {
+                    _engine->Forward(args.src, args.buf, args.dst);
+                }
+
+#ifdef SIMD_RUNTIME_STATISTIC
+                SIMD_INLINE String Info(const Args & args) const
+                {
+                    return "SynetConvolution32f [" + _engine->Param().Info() + "]";
+                }
+#endif
+
+            private:
+                SynetConvolution32f * _engine;
+                String _name;
+            };
+
+            SynetConvolution32fPtrs _engines;
+            String _key;
+            Runtime<Func, Args> _runtime;
+        };
+
+        class SynetConvolution32fSelector
+        {
+        public:
+            SynetConvolution32fSelector(const ConvParam32f & p)
+                : _param(p)
+                , _autotune(SynetConvolution32fAutotuneEnable())
+            {
+            }
+
+            template<class Engine> SynetConvolution32fSelector & Add()
+            {
+                if ((_engines.empty() || _autotune) && Engine::Preferable(_param))
+                    _engines.push_back(new Engine(_param));
+                return *this;
+            }
+
+            template<class Engine> void * Last()
+            {
+                if (_engines.empty() || _autotune)
+                    _engines.push_back(new Engine(_param));
+                return Result();
+            }
+
+        private:
+            void * Result();
+
+            ConvParam32f _param;
+            bool _autotune;
+            SynetConvolution32fPtrs _engines;
+        };
+
+        //-----------------------------------------------------------------------------------------
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
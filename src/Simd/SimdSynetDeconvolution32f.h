@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
 
 #ifdef _N
 #undef _N
@@ -114,6 +115,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _threadNumber(0)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -155,6 +157,7 @@ namespace Simd
                 return buffer;
             else
             {
+                assert(ExternalBufferSize() == 0 || !Base::SynetGetStrictBuffer());
                 _buffer.Resize(ExternalBufferSize());
                 return _buffer.data;
             }
@@ -170,6 +173,16 @@ namespace Simd
             return _info.c_str();
         }
 
+        size_t ThreadNumber() const
+        {
+            return _threadNumber;
+        }
+
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = threadNumber;
+        }
+
     protected:
         typedef void(*NhwcReorderB)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
@@ -185,6 +198,7 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        size_t _threadNumber;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -239,6 +253,26 @@ namespace Simd
             DeconvolutionPtr _deconvolution;
         };
 
+        class SynetDeconvolution32fBf16Gemm : public SynetDeconvolution32fGemmNN
+        {
+        public:
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+            SynetDeconvolution32fBf16Gemm(const DeconvParam32f& p, ConvolutionInitPtr init, BiasAndActivation biasAndActivation);
+            virtual ~SynetDeconvolution32fBf16Gemm();
+            virtual String Ext() const { return _convolution->Ext(); }
+            virtual String Desc() const { return Ext() + "::Bf16Gemm" + (_merge > 1 ? "-" + ToStr(_merge) : ""); }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* buf, float* dst);
+
+            static bool Preferable(const DeconvParam32f& p);
+
+        protected:
+            Simd::SynetConvolution32f* _convolution;
+        };
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -328,6 +362,20 @@ namespace Simd
     }
 #endif
 
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        void* SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))    
+    namespace Amx
+    {
+        void* SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
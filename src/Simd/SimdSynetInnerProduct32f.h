@@ -27,6 +27,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetConvolution32f.h"
 
 namespace Simd
 {
@@ -37,14 +38,16 @@ namespace Simd
         size_t output;
         SimdBool transpose;
         SimdConvolutionActivationType activation;
+        SimdSynetCompatibilityType compatibility;
 
-        InnerProductParam32f(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
+        InnerProductParam32f(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdSynetCompatibilityType c)
         {
             batch = b;
             input = i;
             output = o;
             transpose = t;
             activation = a;
+            compatibility = c;
         }
 
         bool Valid()
@@ -167,7 +170,25 @@ namespace Simd
             void ReorderWeight(const float* src, float* dst);
         };
 
-        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        class SynetInnerProduct32fBf16 : public SynetInnerProduct32f
+        {
+        public:
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+            SynetInnerProduct32fBf16(const InnerProductParam32f& p, ConvolutionInitPtr init);
+            virtual ~SynetInnerProduct32fBf16();
+            virtual String Ext() const { return _convolution->Ext(); }
+            virtual String Desc() const { return Ext() + "::Bf16"; }
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* dst);
+
+        protected:
+            Simd::SynetConvolution32f* _convolution;
+            Array32f _buffer;
+        };
+
+        void * SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -189,7 +210,7 @@ namespace Simd
             virtual String Ext() const { return "Sse41"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 #endif//SIMD_SSE41_ENABLE
 
@@ -212,7 +233,7 @@ namespace Simd
             virtual String Ext() const { return "Avx"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -235,7 +256,7 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 #endif//SIMD_AVX2_ENABLE
 
@@ -258,7 +279,21 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))    
+    namespace Amx
+    {
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 #endif
 
@@ -282,7 +317,7 @@ namespace Simd
             virtual String Ext() const { return "Neon"; }
         };
 
-        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+        void* SynetInnerProduct32fInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
     }
 #endif//SIMD_NEON_ENABLE
 }
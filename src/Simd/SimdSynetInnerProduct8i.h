@@ -0,0 +1,188 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetInnerProduct8i_h__
+#define __SimdSynetInnerProduct8i_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+#include "Simd/SimdSynetConvolution8i.h"
+
+namespace Simd
+{
+    struct InnerProductParam8i
+    {
+        size_t batch;
+        size_t input;
+        size_t output;
+        SimdBool transpose;
+        SimdTensorDataType srcT;
+        SimdTensorDataType dstT;
+        SimdConvolutionActivationType activation;
+        SimdSynetCompatibilityType compatibility;
+
+        InnerProductParam8i(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, SimdConvolutionActivationType a, SimdSynetCompatibilityType c)
+        {
+            batch = b;
+            input = i;
+            output = o;
+            transpose = t;
+            srcT = sT;
+            dstT = dT;
+            activation = a;
+            compatibility = c;
+        }
+
+        bool Valid()
+        {
+            return batch > 0 && input > 0 && output > 0 &&
+                (srcT == SimdTensorData32f || srcT == SimdTensorData8u) && (dstT == SimdTensorData32f || dstT == SimdTensorData8u);
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << input << "x" << output << "-" << transpose;
+            ss << "-" << (srcT == SimdTensorData8u ? "u" : "f") << (dstT == SimdTensorData8u ? "u" : "f");
+            return ss.str();
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * input * output * 2;
+        }
+#endif
+    };
+
+    class SynetInnerProduct8i : public Deletable
+    {
+    public:
+        SynetInnerProduct8i(const InnerProductParam8i& p)
+            : _param(p)
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+            , _perf(NULL)
+#endif
+        {
+        }
+
+        const InnerProductParam8i& Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        virtual size_t ExternalBufferSize() const = 0;
+        virtual size_t InternalBufferSize() const = 0;
+
+        virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats) = 0;
+
+        virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const char* func);
+#endif
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+    protected:
+        InnerProductParam8i _param;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* _perf;
+#endif
+        mutable String _info;
+    };
+
+    namespace Base
+    {
+        class SynetInnerProduct8iConv : public Simd::SynetInnerProduct8i
+        {
+        public:
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+            SynetInnerProduct8iConv(const InnerProductParam8i& p, ConvolutionInitPtr init);
+            virtual ~SynetInnerProduct8iConv();
+            virtual String Ext() const { return _convolution->Ext(); }
+            virtual String Desc() const { return _convolution->Desc(); }
+            virtual size_t ExternalBufferSize() const { return _convolution->ExternalBufferSize(); }
+            virtual size_t InternalBufferSize() const { return _convolution->InternalBufferSize(); }
+            virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+        protected:
+            Simd::SynetConvolution8i* _convolution;
+        };
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+    namespace Avx512vnni
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+    namespace Amx
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+}
+
+#endif//__SimdSynetInnerProduct8i_h__
@@ -191,6 +191,7 @@ namespace Simd
                 return buffer;
             else
             {
+                assert(ExternalBufferSize() == 0 || !Base::SynetGetStrictBuffer());
                 _buffer.Resize(ExternalBufferSize());
                 return _buffer.data;
             }
@@ -224,13 +225,14 @@ namespace Simd
             virtual void ReorderFirstWeight(const float* src, float* dst) const {}
             virtual void ReorderSecondWeight(const float* src, float* dst) const {}
             virtual void ReorderThirdWeight(const float* src, float* dst) const {}
+            void SetThreads(size_t minRows);
 
             ConvolutionPtr _convolution[4];
             size_t _sizeS, _sizeD, _sizeB[2];
             Array32f _rWeight[3], _rBias[3], _rParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
 
-            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3];
+            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3], _threads;
         };
 
         class SynetMergedConvolution32fCdc : public SynetMergedConvolution32f
@@ -247,6 +249,7 @@ namespace Simd
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
             virtual void ReorderThirdWeight(const float* src, float* dst) const;
+            void Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst);
         };
 
         class SynetMergedConvolution32fCd : public SynetMergedConvolution32f
@@ -262,6 +265,7 @@ namespace Simd
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
+            void Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst);
         };
 
         class SynetMergedConvolution32fDc : public SynetMergedConvolution32f
@@ -277,6 +281,7 @@ namespace Simd
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
+            void Forward(const float* src, size_t yBeg, size_t yEnd, float* buf, float* dst);
         };
 
         //-----------------------------------------------------------------------------------------
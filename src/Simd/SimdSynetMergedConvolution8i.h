@@ -196,10 +196,12 @@ namespace Simd
             void ReorderDepthwiseWeight(const ConvParam8i& p, Array32f & weight);
             void ReorderOutputWeight(const ConvParam8i& p, Array8i& weight);
             void DirectConvolution8i(const uint8_t* src, size_t i, size_t q, uint8_t* buf, int32_t* sum, float* dst);
+            void SetThreads(size_t minRows);
+            size_t ThreadBufferSize() const;
 
             MergConvParam8i _param;
             bool _s8u, _d8u, _dw0, _1x1;
-            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5];
+            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5], _threads;
             CvtParam _cvt[3];
             Array8u _buffer;
             Array8i _weight8i[2];
@@ -229,6 +231,7 @@ namespace Simd
 
         protected:
             void SetSize(size_t F);
+            void Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, int32_t* sum, uint8_t* dst);
         };
 
         class SynetMergedConvolution8iCd : public SynetMergedConvolution8i
@@ -242,6 +245,7 @@ namespace Simd
 
         protected:
             void SetSize(size_t F);
+            void Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst);
         };
 
         class SynetMergedConvolution8iDc : public SynetMergedConvolution8i
@@ -255,6 +259,7 @@ namespace Simd
 
         protected:
             void SetSize(size_t F);
+            void Forward(const uint8_t* src, size_t yBeg, size_t yEnd, uint8_t* buf, int32_t* sum, uint8_t* dst);
         };
 
         void* SynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdSynetCompatibilityType compatibility);
@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetNetwork_h__
+#define __SimdSynetNetwork_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdPerformance.h"
+
+#include <vector>
+
+namespace Simd
+{
+    class SynetNetwork : public Deletable
+    {
+    public:
+        typedef void(*EltwisePtr)(float const* const* src, const float* weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float* dst);
+        typedef void(*SoftmaxPtr)(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+        typedef void(*PoolingAveragePtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+            size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+        typedef void(*PoolingMaxPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelC, size_t kernelY, size_t kernelX,
+            size_t strideC, size_t strideY, size_t strideX, size_t padC, size_t padY, size_t padX, float* dst, size_t dstC, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        static const size_t INVALID = size_t(-1);
+
+        SynetNetwork();
+        virtual ~SynetNetwork();
+
+        virtual String Ext() const = 0;
+
+        size_t AddInput(size_t size);
+        size_t AddConvolution32f(void* context, size_t src);
+        size_t AddDeconvolution32f(void* context, size_t src);
+        size_t AddInnerProduct32f(void* context, size_t src);
+        size_t AddMergedConvolution32f(void* context, size_t src);
+        size_t AddEltwise32f(const size_t* src, size_t count, const float* weight, SimdSynetEltwiseOperationType type);
+        size_t AddSoftmax32f(size_t src, size_t outer, size_t count, size_t inner);
+        size_t AddPooling32f(size_t src, size_t batch, const SimdConvolutionParameters* pooling, SimdBool max, SimdBool excludePad);
+
+        bool Plan(const size_t* outputs, size_t count);
+
+        size_t InternalBufferSize() const;
+
+        float* Tensor(size_t tensor);
+
+        void Forward();
+
+        const char* Info() const;
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const char* func);
+#endif
+
+    protected:
+        enum LayerType
+        {
+            LayerConvolution32f,
+            LayerDeconvolution32f,
+            LayerInnerProduct32f,
+            LayerMergedConvolution32f,
+            LayerEltwise32f,
+            LayerSoftmax32f,
+            LayerPoolingAverage32f,
+            LayerPoolingMax32f,
+        };
+
+        struct Layer
+        {
+            LayerType type;
+            Deletable* context;
+            std::vector<size_t> src;
+            std::vector<const float*> ptrs;
+            size_t dst, batch, outer, count, inner;
+            SimdSynetEltwiseOperationType eltwise;
+            Array32f weight;
+            SimdConvolutionParameters pooling;
+            SimdBool excludePad;
+        };
+
+        struct Tensor32f
+        {
+            size_t size, birth, death, offset;
+        };
+
+        size_t AddLayer(Layer* layer, size_t size);
+        bool ValidSrc(size_t src) const;
+
+        EltwisePtr _eltwise;
+        SoftmaxPtr _softmax;
+        PoolingAveragePtr _poolingAverage;
+        PoolingMaxPtr _poolingMax;
+
+        std::vector<Layer*> _layers;
+        std::vector<Tensor32f> _tensors;
+        size_t _scratch, _arena;
+        bool _planned;
+        Array32f _buffer;
+        mutable String _info;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        class SynetNetwork : public Simd::SynetNetwork
+        {
+        public:
+            SynetNetwork();
+            virtual String Ext() const { return "Base"; }
+        };
+
+        void* SynetNetworkInit();
+
+        size_t SynetExternalBufferPlan(const void* const* contexts, const SimdSynetContextType* types, size_t count, SimdBool shared, size_t* offsets);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class SynetNetwork : public Base::SynetNetwork
+        {
+        public:
+            SynetNetwork();
+            virtual String Ext() const { return "Sse41"; }
+        };
+
+        void* SynetNetworkInit();
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class SynetNetwork : public Base::SynetNetwork
+        {
+        public:
+            SynetNetwork();
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void* SynetNetworkInit();
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetNetwork : public Base::SynetNetwork
+        {
+        public:
+            SynetNetwork();
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        void* SynetNetworkInit();
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        class SynetNetwork : public Base::SynetNetwork
+        {
+        public:
+            SynetNetwork();
+            virtual String Ext() const { return "Neon"; }
+        };
+
+        void* SynetNetworkInit();
+    }
+#endif
+}
+
+#endif//__SimdSynetNetwork_h__
@@ -230,6 +230,9 @@ namespace Test
     TEST_ADD_GROUP_A00(Nv12SaveAsJpegToMemory);
     TEST_ADD_GROUP_A00(Yuv420pSaveAsJpegToMemory);
     TEST_ADD_GROUP_A0S(ImageLoadFromMemory);
+    TEST_ADD_GROUP_A00(ImageLoadFromMemoryScaled);
+    TEST_ADD_GROUP_A00(ImageLoadFromMemoryRegion);
+    TEST_ADD_GROUP_A00(ImageDecoder);
 
     TEST_ADD_GROUP_AD0(MeanFilter3x3);
     TEST_ADD_GROUP_AD0(MedianFilterRhomb3x3);
@@ -395,6 +398,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetConvolution8iForward);
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fForwardBatch);
 
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
 
@@ -409,11 +413,15 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetInnerProduct32fForward);
     TEST_ADD_GROUP_A00(SynetInnerProductLayerForward);
     TEST_ADD_GROUP_A00(SynetInnerProduct8i);
+    TEST_ADD_GROUP_A00(SynetInnerProduct8iForward);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution8iForward);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution32fForward);
 
+    TEST_ADD_GROUP_A00(SynetNetworkForward);
+    TEST_ADD_GROUP_A00(SynetExternalBufferPlan);
+
     TEST_ADD_GROUP_A00(SynetPoolingAverage);
     TEST_ADD_GROUP_A00(SynetPoolingMax32f);
     TEST_ADD_GROUP_A00(SynetPoolingMax8u);
@@ -90,7 +90,7 @@ namespace Test
             ss << suffix << ".ppm";
         else if (file == SimdImageFilePng)
             ss << suffix << ".png";
-        if (file == SimdImageFileJpeg)
+        if (file >= SimdImageFileJpeg)
             ss << "_" << ToString(quality) << suffix << ".jpg";
         const String dir = "_out";
         String path = MakePath(dir, ss.str());
@@ -113,7 +113,7 @@ namespace Test
             void Update(View::Format format, SimdImageFileType file, int quality)
             {
                 desc = desc + "[" + ToString(format) + "-" + ToString(file) + 
-                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+                    (file >= SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
             }
 
             void Call(const View& src, SimdImageFileType file, int quality, uint8_t** data, size_t* size) const
@@ -145,7 +145,7 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(if (data2) SimdFree(data2); f2.Call(src, file, quality, &data2, &size2));
 
-        if (file == SimdImageFileJpeg)
+        if (file >= SimdImageFileJpeg)
         {
             View dst1, dst2;
             if (dst1.Load(data1, size1, format) && dst2.Load(data2, size2, format))
@@ -166,7 +166,20 @@ namespace Test
             }
         }
         else
+        {
             result = result && Compare(data1, size1, data2, size2, 0, true, 64);
+            if (file == SimdImageFilePng)
+            {
+                View dst;
+                if (dst.Load(data1, size1, format))
+                    result = result && Compare(dst, src, 0, true, 64, 0, "dst & src");
+                else
+                {
+                    TEST_LOG_SS(Error, "Can't load image from memory!");
+                    result = false;
+                }
+            }
+        }
 
         if (data1)
             Simd::Free(data1);
@@ -197,15 +210,17 @@ namespace Test
         std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32});
         for (int format = 0; format < formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileJpeg; file++)
+            for (int file = (int)SimdImageFilePng; file <= (int)SimdImageFileJpegOptimized; file++)
             {
-                if (file == SimdImageFileJpeg)
+                if (file >= SimdImageFileJpeg)
                 {
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 100, f1, f2);
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 95, f1, f2);
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 85, f1, f2);
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 10, f1, f2);
                 }
+                if (file == SimdImageFilePng)
+                    result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 100, f1, f2);
                 result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 65, f1, f2);
             }
         }
@@ -685,6 +700,336 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncLMS
+        {
+            typedef Simd::ImageLoadFromMemoryScaledPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLMS(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, size_t scale)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) + "-" + ToString(scale) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, size_t scale, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ((View::Format&)dst.format) = format;
+                *(uint8_t**)&dst.data = func(data, size, scale, (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+            }
+        };
+    }
+
+#define FUNC_LMS(func) \
+    FuncLMS(func, std::string(#func))
+
+    bool ImageLoadFromMemoryScaledAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, size_t scale, FuncLMS f1, FuncLMS f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file, scale);
+        f2.Update(format, file, scale);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, 95, &data, &size))
+            return false;
+
+        View dst1, dst2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst1.data) Simd::Free(dst1.data); f1.Call(data, size, scale, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst2.data) SimdFree(dst2.data); f2.Call(data, size, scale, format, dst2));
+
+        if (dst1.width != Simd::DivHi(src.width, scale) || dst1.height != Simd::DivHi(src.height, scale))
+        {
+            TEST_LOG_SS(Error, "Wrong size of scaled image: [" << dst1.width << "x" << dst1.height << "] instead of [" << 
+                Simd::DivHi(src.width, scale) << "x" << Simd::DivHi(src.height, scale) << "]!");
+            result = false;
+        }
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+
+        if (dst1.data)
+            Simd::Free(dst1.data);
+        if (dst2.data)
+            SimdFree(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryScaledAutoTest(const FuncLMS& f1, const FuncLMS& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            for (size_t scale = 2; scale <= 8; scale *= 2)
+            {
+                result = result && ImageLoadFromMemoryScaledAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, scale, f1, f2);
+                result = result && ImageLoadFromMemoryScaledAutoTest(W + O, H - O, formats[format], SimdImageFilePng, scale, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryScaledAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Base::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Sse41::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Neon::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLMR
+        {
+            typedef Simd::ImageLoadFromMemoryRegionPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLMR(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, const Rect& roi, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ((View::Format&)dst.format) = format;
+                *(uint8_t**)&dst.data = func(data, size, roi.left, roi.top, roi.right, roi.bottom, 
+                    (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+            }
+        };
+    }
+
+#define FUNC_LMR(func) \
+    FuncLMR(func, std::string(#func))
+
+    bool ImageLoadFromMemoryRegionAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, FuncLMR f1, FuncLMR f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file);
+        f2.Update(format, file);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, 95, &data, &size))
+            return false;
+
+        View full;
+        ((View::Format&)full.format) = format;
+        *(uint8_t**)&full.data = SimdImageLoadFromMemory(data, size, (size_t*)&full.stride, (size_t*)&full.width, (size_t*)&full.height, (SimdPixelFormatType*)&full.format);
+
+        Rect roi(full.width / 3, full.height / 4, full.width * 3 / 4, full.height * 2 / 3);
+
+        View dst1, dst2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst1.data) Simd::Free(dst1.data); f1.Call(data, size, roi, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst2.data) SimdFree(dst2.data); f2.Call(data, size, roi, format, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        result = result && Compare(dst1, full.Region(roi), 0, true, 64, 0, "dst1 & full");
+
+        if (full.data)
+            SimdFree(full.data);
+        if (dst1.data)
+            Simd::Free(dst1.data);
+        if (dst2.data)
+            SimdFree(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryRegionAutoTest(const FuncLMR& f1, const FuncLMR& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageLoadFromMemoryRegionAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, f1, f2);
+            result = result && ImageLoadFromMemoryRegionAutoTest(W + O, H - O, formats[format], SimdImageFilePng, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageLoadFromMemoryRegionAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageLoadFromMemoryRegionAutoTest(FUNC_LMR(Simd::Base::ImageLoadFromMemoryRegion), FUNC_LMR(SimdImageLoadFromMemoryRegion));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageLoadFromMemoryRegionAutoTest(FUNC_LMR(Simd::Sse41::ImageLoadFromMemoryRegion), FUNC_LMR(SimdImageLoadFromMemoryRegion));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ImageLoadFromMemoryRegionAutoTest(FUNC_LMR(Simd::Neon::ImageLoadFromMemoryRegion), FUNC_LMR(SimdImageLoadFromMemoryRegion));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncID
+        {
+            typedef void* (*FuncPtr)(SimdPixelFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncID(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, size_t parts)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) + "-" + ToString(parts) + "]";
+            }
+
+            bool Call(const uint8_t* data, size_t size, size_t parts, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                void* decoder = func((SimdPixelFormatType)format);
+                if (decoder == NULL)
+                    return false;
+                bool result = true;
+                size_t done = 0, step = Simd::DivHi(size, parts);
+                for (size_t offset = 0; offset < size && result; offset += step)
+                {
+                    result = SimdImageDecoderPush(decoder, data + offset, Simd::Min(step, size - offset)) == SimdTrue;
+                    size_t width, height;
+                    SimdPixelFormatType decoded;
+                    if (result && dst.data == NULL && SimdImageDecoderInfo(decoder, &width, &height, &decoded))
+                        dst.Recreate(width, height, (View::Format)decoded);
+                    if (result && dst.data)
+                        done += SimdImageDecoderPull(decoder, dst.Row<uint8_t>(done), dst.stride, dst.height - done);
+                }
+                SimdRelease(decoder);
+                return result && dst.data && done == dst.height;
+            }
+        };
+    }
+
+#define FUNC_ID(func) \
+    FuncID(func, std::string(#func))
+
+    bool ImageDecoderAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, size_t parts, FuncID f1, FuncID f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file, parts);
+        f2.Update(format, file, parts);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, 95, &data, &size))
+            return false;
+
+        View full;
+        ((View::Format&)full.format) = format;
+        *(uint8_t**)&full.data = SimdImageLoadFromMemory(data, size, (size_t*)&full.stride, (size_t*)&full.width, (size_t*)&full.height, (SimdPixelFormatType*)&full.format);
+
+        View dst1, dst2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(dst1.Clear(); result = result && f1.Call(data, size, parts, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(dst2.Clear(); result = result && f2.Call(data, size, parts, format, dst2));
+
+        if (!result)
+            TEST_LOG_SS(Error, "Can't decode image by parts!");
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        result = result && Compare(dst1, full, 0, true, 64, 0, "dst1 & full");
+
+        if (full.data)
+            SimdFree(full.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageDecoderAutoTest(const FuncID& f1, const FuncID& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageDecoderAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 17, f1, f2);
+            result = result && ImageDecoderAutoTest(W + O, H - O, formats[format], SimdImageFilePng, 5, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageDecoderAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageDecoderAutoTest(FUNC_ID(Simd::Base::ImageDecoderInit), FUNC_ID(SimdImageDecoderInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && ImageDecoderAutoTest(FUNC_ID(Simd::Sse41::ImageDecoderInit), FUNC_ID(SimdImageDecoderInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ImageDecoderAutoTest(FUNC_ID(Simd::Avx2::ImageDecoderInit), FUNC_ID(SimdImageDecoderInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ImageDecoderAutoTest(FUNC_ID(Simd::Avx512bw::ImageDecoderInit), FUNC_ID(SimdImageDecoderInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ImageDecoderAutoTest(FUNC_ID(Simd::Neon::ImageDecoderInit), FUNC_ID(SimdImageDecoderInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ImageLoadFromMemorySpecialTest(const String & name, View::Format format, const FuncLM& f1, const FuncLM& f2)
     {
         bool result = true;
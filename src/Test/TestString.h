@@ -103,6 +103,7 @@ namespace Test
         case SimdImageFilePpmBin:       return "PpmB";
         case SimdImageFilePng:          return "Png";
         case SimdImageFileJpeg:         return "Jpeg";
+        case SimdImageFileJpegOptimized: return "JpegO";
         default: assert(0);  return "";
         }
     }
@@ -157,6 +158,7 @@ namespace Test
         case SimdImageFilePpmBin: return "ppm";
         case SimdImageFilePng:    return "png";
         case SimdImageFileJpeg:   return "jpg";
+        case SimdImageFileJpegOptimized: return "jpg";
         default: assert(0);  return "";
         }
     }
@@ -57,6 +57,12 @@ namespace Test
                 TEST_PERFORMANCE_TEST(desc);
                 ::SimdSynetConvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
             }
+
+            void CallBatch(void * context, const Tensor32f & src, size_t batch, Tensor32f & buf, Tensor32f & dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetConvolution32fForwardBatch(context, src.Data(), batch, buf.Data(), dst.Data());
+            }
         };
     }
 
@@ -652,6 +658,112 @@ namespace Test
             result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
 #endif
 
+        return result;
+    }
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fForwardBatchAutoTest(float eps, const Param & p, size_t batch, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p, SimdSynetCompatibilityDefault);
+        f2.Update(p, SimdSynetCompatibilityDefault);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "] for batch " << batch << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f buf;
+
+        Tensor32f dst1({ batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2({ batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+
+        ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
+        ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
+
+        void * context1 = f1.func(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+        void * context2 = f2.func(batch, &p.conv, SimdSynetCompatibilityDefault);
+
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.CallBatch(context1, src, batch, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardBatchAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType a = SimdConvolutionActivationRelu;
+        const SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && SynetConvolution32fForwardBatchAutoTest(eps, Param(1, 32, 19, 16, 64, _1, _1, _1, _0, _0, 1, a, t), 3, f1, f2);
+        result = result && SynetConvolution32fForwardBatchAutoTest(eps, Param(1, 32, 19, 16, 32, _3, _1, _1, _1, _1, 1, a, t), 4, f1, f2);
+        result = result && SynetConvolution32fForwardBatchAutoTest(eps, Param(2, 64, 10, 10, 64, _3, _1, _1, _1, _1, 64, a, t), 4, f1, f2);
+        result = result && SynetConvolution32fForwardBatchAutoTest(eps, Param(1, 16, 20, 20, 32, _3, _1, _1, _1, _1, 1, a, f), 2, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardBatchAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetConvolution32fForwardBatchAutoTest(2 * EPS, FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution32fForwardBatchAutoTest(4 * EPS, FUNC_C(Simd::Sse41::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetConvolution32fForwardBatchAutoTest(2 * EPS, FUNC_C(Simd::Avx::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fForwardBatchAutoTest(2 * EPS, FUNC_C(Simd::Avx2::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution32fForwardBatchAutoTest(2 * EPS, FUNC_C(Simd::Avx512bw::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fForwardBatchAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+#endif
+
         return result;
     }
 #endif
@@ -28,6 +28,7 @@
 #include "Test/TestSynetConvolutionParam.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdSynet.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 
 namespace Test
@@ -46,14 +47,14 @@ namespace Test
 
             FuncD(const FuncPtr & f, const String & d) : func(f), description(d) {}
 
-            void Update(const Param & p)
+            void Update(const Param & p, SimdSynetCompatibilityType c)
             {
-                description = description + p.Decription();
+                description = description + p.Decription(Simd::Base::Bf16Soft(c) ? "-bf16" : "-fp32");
             }
 
-            void Call(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
+            void Call(const Param & p, SimdSynetCompatibilityType c, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
             {
-                void * context = func(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+                void * context = func(p.batch, &p.conv, c);
                 buf.Extend({ ::SimdSynetDeconvolution32fExternalBufferSize(context) });
                 ::SimdSynetDeconvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
                 {
@@ -68,13 +69,13 @@ namespace Test
 #define FUNC_D(function) \
     FuncD(function, std::string(#function))
 
-    bool SynetDeconvolution32fForwardAutoTest(float eps, const Param & p, FuncD f1, FuncD f2)
+    bool SynetDeconvolution32fForwardAutoTest(float eps, const Param & p, SimdSynetCompatibilityType comp, FuncD f1, FuncD f2)
     {
         bool result = true;
 
 
-        f1.Update(p);
-        f2.Update(p);
+        f1.Update(p, comp);
+        f2.Update(p, comp);
 
         TEST_LOG_SS(Info, "Test [" << f1.description << " & " << f2.description << "].");
 
@@ -119,16 +120,16 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, weight, bias, params, src, buf, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, comp, weight, bias, params, src, buf, dst1));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, weight, bias, params, src, buf, dst2));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, comp, weight, bias, params, src, buf, dst2));
 
         result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
 
         return result;
     }
 
-    bool SynetDeconvolution32fForwardAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, const FuncD & f1, const FuncD & f2)
+    bool SynetDeconvolution32fForwardAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, SimdSynetCompatibilityType c, const FuncD & f1, const FuncD & f2)
     {
         bool result = true;
 
@@ -136,16 +137,17 @@ namespace Test
 
 #ifdef NDEBUG
 #if 0
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 11, 20, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 44, 80, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 32, 44, 80, 30, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 11, 20, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 44, 80, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 32, 44, 80, 30, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
 #if 1
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 70, 17, 23, 33, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
 #else
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
         return result;
     }
@@ -154,16 +156,20 @@ namespace Test
     {
         bool result = true;
 
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationIdentity, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationLeakyRelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationElu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHswish, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationMish, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHardSigmoid, ::SimdTrue, f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationSwish, ::SimdTrue, f1, f2);
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        SimdSynetCompatibilityType bf16 = SimdSynetCompatibility16bfSoft;
+
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationIdentity, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationLeakyRelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationElu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHswish, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationMish, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHardSigmoid, ::SimdTrue, fp32, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationSwish, ::SimdTrue, fp32, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, bf16, f1, f2);
 
         return result;
     }
@@ -194,6 +200,16 @@ namespace Test
             result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Avx512bw::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
 #endif
 
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Avx512bf16::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::Amx::Enable)
+            result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Amx::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
+#endif
+
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable)
             result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Neon::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
@@ -21,6 +21,7 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
+#include "Test/TestUtils.h"
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
@@ -30,6 +31,7 @@
 
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 
 namespace Test
 {
@@ -38,16 +40,16 @@ namespace Test
     {
         struct FuncIP32F
         {
-            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation);
+            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
 
             FuncPtr func;
             String desc;
 
             FuncIP32F(const FuncPtr& f, const String& d) : func(f), desc(d) {}
 
-            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
+            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdSynetCompatibilityType c)
             {
-                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "]";
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + (Simd::Base::Bf16Soft(c) ? "-bf16" : "-fp32") + "]";
             }
 
             void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
@@ -61,12 +63,12 @@ namespace Test
 #define FUNC_IP32F(function) \
     FuncIP32F(function, std::string(#function))
 
-    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, FuncIP32F f1, FuncIP32F f2)
+    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, SimdSynetCompatibilityType c, FuncIP32F f1, FuncIP32F f2)
     {
         bool result = true;
 
-        f1.Update(b, i, o, t, a);
-        f2.Update(b, i, o, t, a);
+        f1.Update(b, i, o, t, a, c);
+        f2.Update(b, i, o, t, a, c);
 
         TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
 
@@ -103,8 +105,8 @@ namespace Test
         ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
         ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
 
-        void* context1 = f1.func(b, i, o, t, a);
-        void* context2 = f2.func(b, i, o, t, a);
+        void* context1 = f1.func(b, i, o, t, a, c);
+        void* context2 = f2.func(b, i, o, t, a, c);
 
         ::SimdSynetInnerProduct32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
         ::SimdSynetInnerProduct32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
@@ -129,51 +131,61 @@ namespace Test
 
         SimdBool t = SimdTrue, f = SimdFalse;
         SimdConvolutionActivationType a = SimdConvolutionActivationIdentity;
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        SimdSynetCompatibilityType bf16 = SimdSynetCompatibility16bfSoft;
 
 #if defined(NDEBUG)
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, f, a, fp32, f1, f2);
 #endif
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, f, a, fp32, f1, f2);
 #endif
 #if 1        
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 192, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 96, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 288, 192, t, a, fp32, f1, f2);
 #endif
 #if 0
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 96, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 192, 192, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 96, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 288, 192, t, a, fp32, f1, f2);
 #endif
 #if 1
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, f, a, f1, f2);       
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, t, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 256, 1024, f, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 254, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, f1, f2);
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, f, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, f, a, fp32, f1, f2);       
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 4096, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 4096, 254, t, a, fp32, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, fp32, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 256, 1024, f, a, fp32, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 254, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, f, a, fp32, f1, f2);
+#endif
+#if 1
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, f, a, bf16, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 256, 1024, t, a, bf16, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, bf16, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 17, 100, 33, f, a, bf16, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 1000, 10, t, a, bf16, f1, f2);
 #endif
 #else
-        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, f1, f2);
-        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, fp32, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, bf16, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, fp32, f1, f2);
+        //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, fp32, f1, f2);
 #endif
 
         return result;
@@ -206,6 +218,16 @@ namespace Test
             result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx512bw::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
 #endif
 
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Avx512bf16::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::Amx::Enable)
+            result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Amx::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
+#endif
+
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable)
             result = result && SynetInnerProduct32fForwardAutoTest(EPS, FUNC_IP32F(Simd::Neon::SynetInnerProduct32fInit), FUNC_IP32F(SimdSynetInnerProduct32fInit));
@@ -423,5 +445,178 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIP8IC
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIP8IC(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, SimdSynetCompatibilityType c)
+            {
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "-"
+                    + (sT == SimdTensorData32f ? "f" : "u") + (dT == SimdTensorData32f ? "f" : "u") + "-"
+                    + (Simd::Base::Narrowed(c) ? "n" : Simd::Base::Overflow(c) ? "o" : "p") + "]";
+            }
+
+            void Call(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct8iForward(context, src, buf, dst);
+            }
+        };
+    }
+
+#define FUNC_IP8IC(function) FuncIP8IC(function, #function)
+
+    bool SynetInnerProduct8iForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, 
+        SimdConvolutionActivationType a, int neg, SimdSynetCompatibilityType c, FuncIP8IC f1, FuncIP8IC f2)
+    {
+        bool result = true;
+
+        f1.Update(b, i, o, t, sT, dT, c);
+        f2.Update(b, i, o, t, sT, dT, c);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f weight({ t ? o : i, t ? i : o });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ o });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ std::max<size_t>(o, 2) });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Shape srcShape = Shp(b, 1, 1, i), dstShape = Shp(b, 1, 1, o);
+        Tensor32f srcMin({ i }), srcMax({ i }), dstMin({ o }), dstMax({ o });
+        Tensor32f src32f(srcShape, SimdTensorFormatNhwc), dst32f1(dstShape, SimdTensorFormatNhwc), dst32f2(dstShape, SimdTensorFormatNhwc);
+        Tensor8u src8u(srcShape, SimdTensorFormatNhwc), dst8u1(dstShape, SimdTensorFormatNhwc), dst8u2(dstShape, SimdTensorFormatNhwc), buf8u;
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), i, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), i, neg, c, NULL, NULL, src8u);
+
+        void* context = ::SimdSynetInnerProduct32fInit(b, i, o, t, SimdConvolutionActivationIdentity, SimdSynetCompatibilityDefault);
+        ::SimdSynetInnerProduct32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetInnerProduct32fForward(context, src32f.Data(), dst32f1.Data());
+        ::SimdRelease(context);
+        if (a == SimdConvolutionActivationRelu)
+        {
+            for (size_t k = 0; k < dst32f1.Size(); ++k)
+                dst32f1.Data()[k] = std::max(dst32f1.Data()[k], 0.0f);
+        }
+        SetDstStat(o, neg, c, dst32f1, dstMin.Data(), dstMax.Data(), NULL, NULL);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t* src = sT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst1 = dT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = dT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32f2, 1.1f);
+
+        Fill(dst8u1, uint8_t(1));
+        Fill(dst8u2, uint8_t(2));
+
+        void* context1 = f1.func(b, i, o, t, sT, dT, a, c);
+        void* context2 = f2.func(b, i, o, t, sT, dT, a, c);
+
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context1) });
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context2) });
+
+        ::SimdSynetInnerProduct8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetInnerProduct8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf8u.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf8u.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+#if defined(SIMD_X64_ENABLE) || defined(SIMD_X86_ENABLE)
+        int differenceMax = (Simd::Base::FmaAvoid(c) ? 0 : 1);
+#else
+        int differenceMax = 1;
+#endif
+
+        if (dT == SimdTensorData32f)
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst8u1, dst8u2, differenceMax, true, 64);
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest(float eps, const FuncIP8IC& f1, const FuncIP8IC& f2)
+    {
+        bool result = true;
+
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+        const SimdSynetCompatibilityType n = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaAvoid);
+
+#ifdef NDEBUG
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 1, 1024, 1000, t1, f32, f32, aId, 1, n, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 10, 512, 256, t0, u8, u8, aRe, 0, n, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 17, 255, 129, t1, u8, f32, aId, 1, n, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 33, 100, 17, t0, f32, u8, aRe, 0, n, f1, f2);
+#else
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 3, 65, 33, t1, u8, u8, aRe, 1, n, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Base::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Sse41::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx2::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx512bw::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx512vnni::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#if defined(SIMD_AMX_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::Amx::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Amx::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Neon::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+        return result;
+    }
 #endif
 }
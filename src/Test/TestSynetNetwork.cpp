@@ -0,0 +1,334 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynetNetwork.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncN
+        {
+            typedef void* (*FuncPtr)();
+
+            FuncPtr func;
+            String desc;
+
+            FuncN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t h, size_t w, size_t c)
+            {
+                desc = desc + "[" + ToString(h) + "x" + ToString(w) + "x" + ToString(c) + "]";
+            }
+
+            void Call(void* network) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetNetworkForward(network);
+            }
+        };
+
+        SimdConvolutionParameters Conv(size_t srcC, size_t srcH, size_t srcW, size_t dstC, size_t kernel, size_t stride, size_t pad, SimdConvolutionActivationType activation)
+        {
+            SimdConvolutionParameters conv;
+            conv.srcC = srcC;
+            conv.srcH = srcH;
+            conv.srcW = srcW;
+            conv.srcT = SimdTensorData32f;
+            conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = dstC;
+            conv.dstH = (srcH + 2 * pad - kernel) / stride + 1;
+            conv.dstW = (srcW + 2 * pad - kernel) / stride + 1;
+            conv.dstT = SimdTensorData32f;
+            conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = kernel;
+            conv.kernelX = kernel;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = stride;
+            conv.strideX = stride;
+            conv.padY = pad;
+            conv.padX = pad;
+            conv.padH = pad;
+            conv.padW = pad;
+            conv.group = 1;
+            conv.activation = activation;
+            return conv;
+        }
+
+        struct Model
+        {
+            SimdConvolutionParameters conv0, pool, conv1;
+            Tensor32f weight0, bias0, weight1, bias1, weight2, bias2, params;
+            size_t size, output;
+
+            Model(size_t h, size_t w, size_t c)
+            {
+                conv0 = Conv(c, h, w, c * 2, 3, 1, 1, SimdConvolutionActivationRelu);
+                pool = Conv(conv0.dstC, conv0.dstH, conv0.dstW, conv0.dstC, 2, 2, 0, SimdConvolutionActivationIdentity);
+                conv1 = Conv(pool.dstC, pool.dstH, pool.dstW, pool.dstC, 1, 1, 0, SimdConvolutionActivationIdentity);
+                size = conv1.dstC * conv1.dstH * conv1.dstW;
+                output = 10;
+                weight0.Reshape(Shp(3, 3, conv0.srcC, conv0.dstC));
+                weight1.Reshape(Shp(conv1.srcC, conv1.dstC));
+                weight2.Reshape(Shp(output, size));
+                bias0.Reshape(Shp(conv0.dstC));
+                bias1.Reshape(Shp(conv1.dstC));
+                bias2.Reshape(Shp(output));
+                params.Reshape(Shp(conv0.dstC));
+                FillRandom(weight0, -1.0f, 1.0f);
+                FillRandom(weight1, -1.0f, 1.0f);
+                FillRandom(weight2, -0.1f, 0.1f);
+                FillRandom(bias0, -1.0f, 1.0f);
+                FillRandom(bias1, -1.0f, 1.0f);
+                FillRandom(bias2, -1.0f, 1.0f);
+                FillRandom(params, 0.0f, 1.0f);
+            }
+
+            void* Create(const FuncN& f, size_t & input, size_t & dst) const
+            {
+                void* network = f.func();
+                input = ::SimdSynetNetworkAddInput(network, conv0.srcC * conv0.srcH * conv0.srcW);
+
+                void* c0 = ::SimdSynetConvolution32fInit(1, &conv0, SimdSynetCompatibilityDefault);
+                ::SimdSynetConvolution32fSetParams(c0, weight0.Data(), NULL, bias0.Data(), params.Data());
+                size_t t0 = ::SimdSynetNetworkAddConvolution32f(network, c0, input);
+
+                size_t t1 = ::SimdSynetNetworkAddPooling32f(network, t0, 1, &pool, SimdTrue, SimdFalse);
+
+                void* c1 = ::SimdSynetConvolution32fInit(1, &conv1, SimdSynetCompatibilityDefault);
+                ::SimdSynetConvolution32fSetParams(c1, weight1.Data(), NULL, bias1.Data(), params.Data());
+                size_t t2 = ::SimdSynetNetworkAddConvolution32f(network, c1, t1);
+
+                size_t ts[2] = { t1, t2 };
+                size_t t3 = ::SimdSynetNetworkAddEltwise32f(network, ts, 2, NULL, SimdSynetEltwiseOperationSum);
+
+                void* ip = ::SimdSynetInnerProduct32fInit(1, size, output, SimdTrue, SimdConvolutionActivationIdentity, SimdSynetCompatibilityDefault);
+                ::SimdSynetInnerProduct32fSetParams(ip, weight2.Data(), NULL, bias2.Data(), NULL);
+                size_t t4 = ::SimdSynetNetworkAddInnerProduct32f(network, ip, t3);
+
+                dst = ::SimdSynetNetworkAddSoftmax32f(network, t4, 1, output, 1);
+                ::SimdSynetNetworkPlan(network, &dst, 1);
+                return network;
+            }
+
+            void Reference(const Tensor32f& src, Tensor32f& dst) const
+            {
+                Tensor32f buf, d0(Shp(conv0.dstH, conv0.dstW, conv0.dstC)), d1(Shp(pool.dstH, pool.dstW, pool.dstC)),
+                    d2(Shp(conv1.dstH, conv1.dstW, conv1.dstC)), d3(Shp(size)), d4(Shp(output));
+
+                void* c0 = ::SimdSynetConvolution32fInit(1, &conv0, SimdSynetCompatibilityDefault);
+                buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(c0) });
+                ::SimdSynetConvolution32fSetParams(c0, weight0.Data(), NULL, bias0.Data(), params.Data());
+                ::SimdSynetConvolution32fForward(c0, src.Data(), buf.Data(), d0.Data());
+                ::SimdRelease(c0);
+
+                ::SimdSynetPoolingMax32f(d0.Data(), pool.srcC, pool.srcH, pool.srcW, 1, pool.kernelY, pool.kernelX, 1, pool.strideY, pool.strideX,
+                    0, pool.padY, pool.padX, d1.Data(), pool.dstC, pool.dstH, pool.dstW, pool.srcF);
+
+                void* c1 = ::SimdSynetConvolution32fInit(1, &conv1, SimdSynetCompatibilityDefault);
+                buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(c1) });
+                ::SimdSynetConvolution32fSetParams(c1, weight1.Data(), NULL, bias1.Data(), params.Data());
+                ::SimdSynetConvolution32fForward(c1, d1.Data(), buf.Data(), d2.Data());
+                ::SimdRelease(c1);
+
+                const float* srcs[2] = { d1.Data(), d2.Data() };
+                const float weights[2] = { 1.0f, 1.0f };
+                ::SimdSynetEltwiseLayerForward(srcs, weights, 2, size, SimdSynetEltwiseOperationSum, d3.Data());
+
+                void* ip = ::SimdSynetInnerProduct32fInit(1, size, output, SimdTrue, SimdConvolutionActivationIdentity, SimdSynetCompatibilityDefault);
+                ::SimdSynetInnerProduct32fSetParams(ip, weight2.Data(), NULL, bias2.Data(), NULL);
+                ::SimdSynetInnerProduct32fForward(ip, d3.Data(), d4.Data());
+                ::SimdRelease(ip);
+
+                ::SimdSynetSoftmaxLayerForward(d4.Data(), 1, output, 1, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_N(function) FuncN(function, #function)
+
+    bool SynetNetworkForwardAutoTest(size_t h, size_t w, size_t c, FuncN f1, FuncN f2)
+    {
+        bool result = true;
+
+        f1.Update(h, w, c);
+        f2.Update(h, w, c);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Model model(h, w, c);
+
+        Tensor32f src(Shp(h, w, c)), dst0(Shp(model.output)), dst1(Shp(model.output)), dst2(Shp(model.output));
+        FillRandom(src, -1.0f, 1.0f);
+        model.Reference(src, dst0);
+
+        size_t input1, input2, output1, output2;
+        void* network1 = model.Create(f1, input1, output1);
+        void* network2 = model.Create(f2, input2, output2);
+
+        TEST_LOG_SS(Info, ::SimdSynetNetworkInfo(network1));
+
+        memcpy(::SimdSynetNetworkTensor(network1, input1), src.Data(), src.Size() * sizeof(float));
+        memcpy(::SimdSynetNetworkTensor(network2, input2), src.Data(), src.Size() * sizeof(float));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(network1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(network2));
+
+        memcpy(dst1.Data(), ::SimdSynetNetworkTensor(network1, output1), dst1.Size() * sizeof(float));
+        memcpy(dst2.Data(), ::SimdSynetNetworkTensor(network2, output2), dst2.Size() * sizeof(float));
+
+        ::SimdRelease(network1);
+        ::SimdRelease(network2);
+
+        result = result && Compare(dst0, dst1, EPS, true, 64, DifferenceBoth);
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetNetworkForwardAutoTest(const FuncN& f1, const FuncN& f2)
+    {
+        bool result = true;
+
+        result = result && SynetNetworkForwardAutoTest(32, 32, 16, f1, f2);
+        result = result && SynetNetworkForwardAutoTest(19, 23, 7, f1, f2);
+
+        return result;
+    }
+
+    bool SynetNetworkForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetNetworkForwardAutoTest(FUNC_N(Simd::Base::SynetNetworkInit), FUNC_N(SimdSynetNetworkInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetNetworkForwardAutoTest(FUNC_N(Simd::Sse41::SynetNetworkInit), FUNC_N(SimdSynetNetworkInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetNetworkForwardAutoTest(FUNC_N(Simd::Avx2::SynetNetworkInit), FUNC_N(SimdSynetNetworkInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetNetworkForwardAutoTest(FUNC_N(Simd::Avx512bw::SynetNetworkInit), FUNC_N(SimdSynetNetworkInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetNetworkForwardAutoTest(FUNC_N(Simd::Neon::SynetNetworkInit), FUNC_N(SimdSynetNetworkInit));
+#endif
+
+        return result;
+    }
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetExternalBufferPlanAutoTest(size_t h, size_t w, size_t c)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetExternalBufferPlan[" << h << "x" << w << "x" << c << "].");
+
+        Model model(h, w, c);
+
+        Tensor32f src(Shp(h, w, c)), dst0(Shp(model.output)), dst1(Shp(model.output));
+        FillRandom(src, -1.0f, 1.0f);
+        model.Reference(src, dst0);
+
+        const SimdConvolutionParameters& conv0 = model.conv0, & pool = model.pool, & conv1 = model.conv1;
+        void* contexts[3];
+        contexts[0] = ::SimdSynetConvolution32fInit(1, &conv0, SimdSynetCompatibilityDefault);
+        ::SimdSynetConvolution32fSetParams(contexts[0], model.weight0.Data(), NULL, model.bias0.Data(), model.params.Data());
+        contexts[1] = ::SimdSynetConvolution32fInit(1, &conv1, SimdSynetCompatibilityDefault);
+        ::SimdSynetConvolution32fSetParams(contexts[1], model.weight1.Data(), NULL, model.bias1.Data(), model.params.Data());
+        contexts[2] = ::SimdSynetInnerProduct32fInit(1, model.size, model.output, SimdTrue, SimdConvolutionActivationIdentity, SimdSynetCompatibilityDefault);
+        ::SimdSynetInnerProduct32fSetParams(contexts[2], model.weight2.Data(), NULL, model.bias2.Data(), NULL);
+        const SimdSynetContextType types[3] = { SimdSynetContextConvolution32f, SimdSynetContextConvolution32f, SimdSynetContextInnerProduct32f };
+
+        size_t sizes[2] = { ::SimdSynetConvolution32fExternalBufferSize(contexts[0]) * sizeof(float),
+            ::SimdSynetConvolution32fExternalBufferSize(contexts[1]) * sizeof(float) };
+        size_t shared[3], separate[3], align = ::SimdAlignment();
+        size_t sharedSize = ::SimdSynetExternalBufferPlan(contexts, types, 3, SimdTrue, shared);
+        size_t separateSize = ::SimdSynetExternalBufferPlan(contexts, types, 3, SimdFalse, separate);
+        if (sharedSize < std::max(sizes[0], sizes[1]) || shared[0] != 0 || shared[1] != 0 || shared[2] != 0)
+        {
+            TEST_LOG_SS(Error, "Wrong shared plan: arena " << sharedSize << " bytes for buffers " << sizes[0] << " and " << sizes[1] << " bytes!");
+            result = false;
+        }
+        if (separateSize < separate[1] + sizes[1] || separate[1] < separate[0] + sizes[0] || separate[1] % align || separate[2] % align)
+        {
+            TEST_LOG_SS(Error, "Wrong separate plan: arena " << separateSize << " bytes, offsets " << separate[0] << ", " << separate[1] << ", " << separate[2] << "!");
+            result = false;
+        }
+
+        Tensor32f d0(Shp(conv0.dstH, conv0.dstW, conv0.dstC)), d1(Shp(pool.dstH, pool.dstW, pool.dstC)),
+            d2(Shp(conv1.dstH, conv1.dstW, conv1.dstC)), d3(Shp(model.size)), d4(Shp(model.output));
+        Tensor8u arena(Shp(sharedSize));
+
+        SimdBool strict = ::SimdSynetGetStrictBuffer();
+        ::SimdSynetSetStrictBuffer(SimdTrue);
+
+        ::SimdSynetConvolution32fForward(contexts[0], src.Data(), (float*)(arena.Data() + shared[0]), d0.Data());
+        ::SimdSynetPoolingMax32f(d0.Data(), pool.srcC, pool.srcH, pool.srcW, 1, pool.kernelY, pool.kernelX, 1, pool.strideY, pool.strideX,
+            0, pool.padY, pool.padX, d1.Data(), pool.dstC, pool.dstH, pool.dstW, pool.srcF);
+        ::SimdSynetConvolution32fForward(contexts[1], d1.Data(), (float*)(arena.Data() + shared[1]), d2.Data());
+        const float* srcs[2] = { d1.Data(), d2.Data() };
+        const float weights[2] = { 1.0f, 1.0f };
+        ::SimdSynetEltwiseLayerForward(srcs, weights, 2, model.size, SimdSynetEltwiseOperationSum, d3.Data());
+        ::SimdSynetInnerProduct32fForward(contexts[2], d3.Data(), d4.Data());
+        ::SimdSynetSoftmaxLayerForward(d4.Data(), 1, model.output, 1, dst1.Data());
+
+        ::SimdSynetSetStrictBuffer(strict);
+
+        for (size_t i = 0; i < 3; ++i)
+            ::SimdRelease(contexts[i]);
+
+        result = result && Compare(dst0, dst1, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetExternalBufferPlanAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetExternalBufferPlanAutoTest(32, 32, 16);
+        result = result && SynetExternalBufferPlanAutoTest(19, 23, 7);
+
+        return result;
+    }
+#endif
+}